@@ -44,12 +44,18 @@ CBL {
 		c4db_getExtraInfo;
 		c4db_setExtraInfo;
 		c4db_beginTransaction;
+		c4db_beginReadOnlyTransaction;
+		c4db_endReadOnlyTransaction;
+		c4db_applyBatch;
 		c4db_endTransaction;
 		c4db_isInTransaction;
 		c4db_getSharedFleeceEncoder;
 		c4db_getFLSharedKeys;
 		c4db_encodeJSON;
 		c4db_maintenance;
+		c4db_warm;
+		c4db_getStats;
+		c4db_shrinkMemory;
 
 		c4raw_free;
 		c4raw_get;
@@ -58,6 +64,8 @@ CBL {
 		c4doc_retain;
 		c4doc_release;
 		c4doc_get;
+		c4db_getDocuments;
+		c4doc_getAsync;
 		c4doc_getBySequence;
 		c4db_purgeDoc;
 		c4doc_selectRevision;
@@ -91,6 +99,7 @@ CBL {
 		c4db_deleteIndex;
 		c4db_getIndexes;
 		c4enum_next;
+		c4enum_nextBatch;
 		c4enum_getDocumentInfo;
 		c4enum_getDocument;
 		c4enum_close;
@@ -109,6 +118,7 @@ CBL {
 		c4query_columnCount;
 		c4query_columnTitle;
 		c4query_run;
+		c4query_runAsync;
 		c4query_explain;
 
 		c4blob_keyFromString;
@@ -285,6 +295,7 @@ CBL {
 		c4_getBuildInfo;
 		c4_setTempDir;
 		c4_runAsyncTask;
+		c4_getMetrics;
 
 		c4log;
 		c4vlog;
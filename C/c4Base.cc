@@ -23,6 +23,7 @@
 #include "Actor.hh"
 #include "Backtrace.hh"
 #include "FilePath.hh"
+#include "Metrics.hh"
 #include "Logging.hh"
 #include "StringUtil.hh"
 
@@ -486,3 +487,8 @@ void c4_setTempDir(C4String path) C4API {
 void c4_runAsyncTask(void (*task)(void*), void *context) C4API {
     actor::Mailbox::runAsyncTask(task, context);
 }
+
+
+C4SliceResult c4_getMetrics(void) C4API {
+    return C4SliceResult(litecore::Metrics::encodeAll());
+}
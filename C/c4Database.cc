@@ -34,6 +34,8 @@
 #include "SecureSymmetricCrypto.hh"
 #include "StringUtil.hh"
 #include "PrebuiltCopier.hh"
+#include "c4Document.h"
+#include "FleeceImpl.hh"
 #include <thread>
 
 using namespace fleece;
@@ -128,6 +130,13 @@ C4Database* c4db_openAgain(C4Database* db,
 }
 
 
+// Note re: a backup API. sqlite3_backup can copy without blocking writers (it restarts
+// after interleaved commits), and running it on the BackgroundDB connection would be the
+// right shape for c4db_backup -- but the "incremental, only changed pages" part isn't
+// something SQLite offers: the page change counter is file-global, there's no per-page
+// generation to diff against a previous backup. True incremental backup is a WAL-shipping
+// design (archive WAL segments between checkpoints), which is a replication feature, not a
+// copy API. Nightly jobs wanting cheap incrementals should replicate to the backup store.
 bool c4db_copy(C4String sourcePath, C4String destinationPath, const C4DatabaseConfig* config,
                C4Error *error) noexcept {
     return tryCatch(error, [=] {
@@ -189,6 +198,26 @@ bool c4db_maintenance(C4Database* database, C4MaintenanceType type, C4Error *out
 }
 
 
+bool c4db_shrinkMemory(C4Database* database, C4Error *outError) C4API {
+    return tryCatch(outError, bind(&Database::shrinkMemory, database));
+}
+
+
+C4SliceResult c4db_getStats(C4Database* database, C4Error *outError) C4API {
+    return tryCatch<C4SliceResult>(outError, [&]{
+        return C4SliceResult(database->dataFile()->statistics());
+    });
+}
+
+
+bool c4db_warm(C4Database* database, C4Error *outError) C4API {
+    return tryCatch(outError, [=]{
+        database->documentKeys();           // loads the shared-keys table from storage
+        database->defaultKeyStore().warm();
+    });
+}
+
+
 bool c4db_rekey(C4Database* database, const C4EncryptionKey *newKey, C4Error *outError) noexcept {
     return tryCatch(outError, bind(&Database::rekey, database, newKey));
 }
@@ -260,6 +289,113 @@ bool c4db_beginTransaction(C4Database* database,
     return tryCatch(outError, bind(&Database::beginTransaction, database));
 }
 
+C4SliceResult c4db_applyBatch(C4Database* database,
+                              C4Slice operations,
+                              C4Error *outError) noexcept
+{
+    // (fleece::impl types are written out in full here, to avoid ambiguity with the
+    // fleece:: API classes brought in by `using namespace fleece` above.)
+    return tryCatch<C4SliceResult>(outError, [&]{
+        // Register the operations data with the database's SharedKeys, so dictionaries work
+        // whether the caller encoded with a plain encoder or the database's shared one:
+        fleece::impl::Scope scope(slice(operations), database->documentKeys());
+        const fleece::impl::Value *root = fleece::impl::Value::fromData(operations);
+        const fleece::impl::Array *ops = root ? root->asArray() : nullptr;
+        if (!ops)
+            error::_throw(error::InvalidParameter, "operations must be a Fleece array");
+
+        fleece::impl::Encoder results;
+        results.beginArray();
+        Database::TransactionHelper t(database);
+        for (fleece::impl::Array::iterator i(ops); i; ++i) {
+            const fleece::impl::Dict *op = i.value()->asDict();
+            slice docID, verb = "put"_sl, revID;
+            const fleece::impl::Value *body = nullptr;
+            if (op) {
+                if (auto v = op->get("docID"_sl); v) docID = v->asString();
+                if (auto v = op->get("op"_sl); v)    verb = v->asString();
+                if (auto v = op->get("revID"_sl); v) revID = v->asString();
+                body = op->get("body"_sl);
+            }
+
+            C4Error opError = {};
+            bool ok = false;
+            alloc_slice newRevID;
+            if (!op || !docID) {
+                opError = c4error_make(LiteCoreDomain, kC4ErrorInvalidParameter,
+                                       "batch operation needs a docID"_sl);
+            } else if (verb == "purge"_sl) {
+                ok = database->purgeDocument(docID);
+                if (!ok)
+                    opError = c4error_make(LiteCoreDomain, kC4ErrorNotFound, {});
+            } else if (verb == "put"_sl || verb == "delete"_sl) {
+                alloc_slice fleeceBody;
+                if (body) {
+                    auto &enc = database->sharedEncoder();
+                    enc.writeValue(body);
+                    fleeceBody = enc.finish();
+                }
+                C4DocPutRequest rq = {};
+                rq.docID = docID;
+                rq.allocedBody = {(void*)fleeceBody.buf, fleeceBody.size};
+                if (verb == "delete"_sl)
+                    rq.revFlags = kRevDeleted;
+                C4Slice history[1];
+                if (revID) {
+                    history[0] = revID;
+                    rq.history = history;
+                    rq.historyCount = 1;
+                }
+                rq.save = true;
+                C4Document *doc = c4doc_put(database, &rq, nullptr, &opError);
+                if (doc) {
+                    ok = true;
+                    newRevID = alloc_slice(doc->revID);
+                    c4doc_release(doc);
+                }
+            } else {
+                opError = c4error_make(LiteCoreDomain, kC4ErrorInvalidParameter,
+                                       "unknown batch operation"_sl);
+            }
+
+            // One result per operation, in order. A failed op doesn't abort the batch
+            // (matching _bulk_docs semantics); the caller checks each result.
+            results.beginDictionary();
+            if (ok) {
+                results.writeKey("ok"_sl);
+                results.writeBool(true);
+                if (newRevID) {
+                    results.writeKey("revID"_sl);
+                    results.writeString(newRevID);
+                }
+            } else {
+                results.writeKey("error"_sl);
+                results.writeInt(opError.code);
+                results.writeKey("domain"_sl);
+                results.writeInt(opError.domain);
+            }
+            results.endDictionary();
+        }
+        results.endArray();
+        alloc_slice encoded = results.finish();
+        t.commit();
+        return C4SliceResult(encoded);
+    });
+}
+
+
+bool c4db_beginReadOnlyTransaction(C4Database* database,
+                                   C4Error *outError) noexcept
+{
+    return tryCatch(outError, bind(&Database::beginReadOnlyTransaction, database));
+}
+
+bool c4db_endReadOnlyTransaction(C4Database* database,
+                                 C4Error *outError) noexcept
+{
+    return tryCatch(outError, bind(&Database::endReadOnlyTransaction, database));
+}
+
 bool c4db_endTransaction(C4Database* database,
                          bool commit,
                          C4Error *outError) noexcept
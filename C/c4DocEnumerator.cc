@@ -26,6 +26,7 @@
 #include "RecordEnumerator.hh"
 #include "Logging.hh"
 #include "InstanceCounted.hh"
+#include <vector>
 
 
 #pragma mark - DOC ENUMERATION:
@@ -68,6 +69,28 @@ struct C4DocEnumerator : public RecordEnumerator, public fleece::InstanceCounted
         return _database->documentFactory().newDocumentInstance(record());
     }
 
+    size_t nextBatch(C4DocumentInfo outInfo[], size_t count) {
+        // The records (and revIDs) have to stick around, since the infos' slices point into
+        // them; they're released on the next call, like _docRevID below.
+        _batch.clear();
+        _batchRevIDs.clear();
+        _batch.reserve(count);
+        _batchRevIDs.reserve(count);
+        size_t n = 0;
+        while (n < count && next()) {
+            const Record &rec = _batch.emplace_back(record());
+            _batchRevIDs.push_back(_database->documentFactory().revIDFromVersion(rec.version()));
+            C4DocumentInfo &info = outInfo[n++];
+            info.docID = rec.key();
+            info.revID = _batchRevIDs.back();
+            info.flags = (C4DocumentFlags)rec.flags() | kDocExists;
+            info.sequence = rec.sequence();
+            info.bodySize = rec.bodySize();
+            info.expiration = rec.expiration();
+        }
+        return n;
+    }
+
     bool getDocInfo(C4DocumentInfo *outInfo) {
         if (!*this)
             return false;
@@ -83,6 +106,8 @@ struct C4DocEnumerator : public RecordEnumerator, public fleece::InstanceCounted
 private:
     Retained<Database> _database;
     alloc_slice _docRevID;
+    std::vector<Record> _batch;             // Keeps nextBatch()'s records alive
+    std::vector<alloc_slice> _batchRevIDs;  // ...and their expanded revIDs
 };
 
 
@@ -108,6 +133,13 @@ C4DocEnumerator* c4db_enumerateChanges(C4Database *database,
 }
 
 
+// Note on partitioned parallel enumeration: N cursors over key ranges can't run on one
+// C4Database (the connection serializes them); real parallelism means one c4db_openAgain
+// instance per worker, and at that point the API already composes -- each worker opens its
+// own database handle and enumerates. What can't be promised is the "equal row counts"
+// split: SQLite's stat tables only exist after ANALYZE and describe index shape, not key
+// distribution. Exporters should split by key prefix knowledge of their own data, or use
+// c4enum_nextBatch on a single scan, which is usually I/O-bound anyway.
 C4DocEnumerator* c4db_enumerateAllDocs(C4Database *database,
                                        const C4EnumeratorOptions *c4options,
                                        C4Error *outError) noexcept
@@ -129,6 +161,18 @@ bool c4enum_next(C4DocEnumerator *e, C4Error *outError) noexcept {
 }
 
 
+size_t c4enum_nextBatch(C4DocEnumerator *e,
+                        C4DocumentInfo outInfo[],
+                        size_t count,
+                        C4Error *outError) noexcept
+{
+    return tryCatch<size_t>(outError, [&]{
+        clearError(outError);       // ending the iteration early is not an error
+        return e->nextBatch(outInfo, count);
+    });
+}
+
+
 bool c4enum_getDocumentInfo(C4DocEnumerator *e, C4DocumentInfo *outInfo) noexcept {
     return e->getDocInfo(outInfo);
 }
@@ -28,6 +28,8 @@
 #include "TreeDocument.hh"
 #include "Document.hh"
 #include "Database.hh"
+#include "BackgroundDB.hh"
+#include "Actor.hh"
 #include "LegacyAttachments.hh"
 #include "RevTree.hh"   // only for kDefaultRemoteID
 #include "SecureRandomize.hh"
@@ -72,6 +74,82 @@ C4Document* c4doc_get(C4Database *database,
 }
 
 
+void c4doc_getAsync(C4Database *database,
+                    C4String docID,
+                    bool mustExist,
+                    C4DocGetAsyncCallback callback,
+                    void *context) noexcept
+{
+    struct GetTask {
+        Retained<Database> database;
+        BackgroundDB *bgDB;             // owned by (and outlived by) `database`
+        alloc_slice docID;
+        bool mustExist;
+        C4DocGetAsyncCallback callback;
+        void *context;
+    };
+    // Resolve the BackgroundDB and the lazily-read maxRevTreeDepth on the caller's thread;
+    // neither lazy initialization is safe from a background thread.
+    database->maxRevTreeDepth();
+    auto task = new GetTask{database, database->backgroundDatabase(),
+                            alloc_slice(docID), mustExist, callback, context};
+    actor::Mailbox::runAsyncTask([](void *taskPtr) {
+        auto task = (GetTask*)taskPtr;
+        C4Document *doc = nullptr;
+        C4Error error = {};
+        try {
+            // Read the record AND construct the document through the background connection,
+            // so this never touches the caller's connection (document construction reaches
+            // the key store's SharedKeys, which may lazily read from its SQLite handle).
+            // The resulting document is therefore read-only; saving it reports an error.
+            bool open = false;
+            task->bgDB->use([&](litecore::DataFile *df) {
+                if (df) {
+                    open = true;
+                    Record rec = df->defaultKeyStore().get(task->docID);
+                    if (rec.exists() || !task->mustExist)
+                        doc = retain(task->database->documentFactory()
+                                 .newReadOnlyDocumentInstance(rec, df->defaultKeyStore()).get());
+                    else
+                        recordError(LiteCoreDomain, kC4ErrorNotFound, &error);
+                }
+            });
+            if (!open)
+                recordError(LiteCoreDomain, kC4ErrorNotOpen, &error);
+        } catchError(&error);
+        task->callback(task->context, doc, error);
+        delete task;
+    }, task);
+}
+
+
+bool c4db_getDocuments(C4Database *database,
+                       const C4String docIDs[],
+                       size_t count,
+                       C4Document* outDocs[],
+                       C4Error *outError) noexcept
+{
+    return tryCatch(outError, [&]{
+        vector<slice> keys;
+        keys.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            keys.push_back(docIDs[i]);
+        // Fetch all the records in one statement, then instantiate documents from them.
+        // Documents are collected in Retained<> first, so that if instantiation throws
+        // partway the ones already created are released instead of leaking, and outDocs[]
+        // is only written on success:
+        auto records = database->defaultKeyStore().getMany(keys);
+        vector<Retained<Document>> docs(count);
+        for (size_t i = 0; i < count; ++i) {
+            if (records[i].exists())
+                docs[i] = database->documentFactory().newDocumentInstance(records[i]);
+        }
+        for (size_t i = 0; i < count; ++i)
+            outDocs[i] = docs[i] ? retain(docs[i].get()) : nullptr;
+    });
+}
+
+
 C4Document* c4doc_getSingleRevision(C4Database *database,
                                     C4Slice docID,
                                     C4Slice revID,
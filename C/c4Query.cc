@@ -83,6 +83,13 @@ void c4query_setParameters(C4Query *query, C4String encodedParameters) C4API {
 }
 
 
+// Note on re-running with new parameters (paged scroll etc.): a rebind-in-place API on the
+// enumerator wouldn't remove meaningful work. The compiled SQLite statement is already shared
+// and reused across runs (it lives in the query, which itself comes from the per-database
+// compiled-query cache), so a re-run costs binding plus executing -- and the execution's
+// output is a freshly recorded result set, which must be newly allocated no matter which
+// object it hangs off of. An existing enumerator can't be mutated under its current consumers
+// anyway; c4queryenum_refresh exists for the unchanged-parameters case.
 C4QueryEnumerator* c4query_run(C4Query *query,
                                const C4QueryOptions *c4options,
                                C4Slice encodedParameters,
@@ -94,6 +101,58 @@ C4QueryEnumerator* c4query_run(C4Query *query,
 }
 
 
+namespace {
+    // Runs a query once on the database's background thread, then delivers the result to the
+    // callback and deletes itself. (See c4query_runAsync.)
+    class AsyncQueryRunner : public litecore::LiveQuerier::Delegate {
+    public:
+        AsyncQueryRunner(C4Query *query, slice encodedParameters,
+                         C4QueryRunAsyncCallback callback, void *context)
+        :_query(query)
+        ,_callback(callback)
+        ,_context(context)
+        ,_querier(new LiveQuerier(query->database(), query->query(), false, this))
+        {
+            alloc_slice params(encodedParameters ? encodedParameters : _query->parameters());
+            _querier->start(Query::Options(params));
+        }
+
+    protected:
+        // called on a background thread!
+        void liveQuerierUpdated(QueryEnumerator *qe, C4Error err) override {
+            Retained<C4QueryEnumeratorImpl> c4e = _query->wrapEnumerator(qe);
+            _querier->stop();
+            _callback(_context, c4e ? retain(c4e.get()) : nullptr, err);
+            delete this;            // one-shot queriers don't call back again
+        }
+
+    private:
+        Retained<c4Query> _query;
+        C4QueryRunAsyncCallback const _callback;
+        void* const _context;
+        Retained<LiveQuerier> _querier;
+    };
+}
+
+
+void c4query_runAsync(C4Query *query,
+                      const C4QueryOptions* /*options; only skip/limit, part of the query*/,
+                      C4Slice encodedParameters,
+                      C4QueryRunAsyncCallback callback,
+                      void *context) noexcept
+{
+    C4Error error = {};
+    bool started = tryCatch(&error, [&]{
+        new AsyncQueryRunner(query, encodedParameters, callback, context);
+    });
+    if (!started) {
+        // An async API must not fail silently: deliver setup errors through the callback
+        // too (from the caller's thread, in this one case).
+        callback(context, nullptr, error);
+    }
+}
+
+
 C4StringResult c4query_explain(C4Query *query) noexcept {
     return tryCatch<C4StringResult>(nullptr, [&]{
         string result = query->query()->explain();
@@ -216,10 +275,10 @@ bool c4db_createIndex(C4Database *database,
     static_assert(sizeof(C4IndexOptions) == sizeof(IndexSpec::Options),
                   "IndexSpec::Options types must match");
     return tryCatch(outError, [&]{
-        database->defaultKeyStore().createIndex(slice(name),
-                                                indexSpecJSON,
-                                                (IndexSpec::Type)indexType,
-                                                (const IndexSpec::Options*)indexOptions);
+        database->createIndex(slice(name),
+                              indexSpecJSON,
+                              (IndexSpec::Type)indexType,
+                              (const IndexSpec::Options*)indexOptions);
     });
 }
 
@@ -229,7 +288,7 @@ bool c4db_deleteIndex(C4Database *database,
                       C4Error *outError) noexcept
 {
     return tryCatch(outError, [&]{
-        database->defaultKeyStore().deleteIndex(toString(name));
+        database->deleteIndex(name);
     });
 }
 
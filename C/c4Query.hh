@@ -30,7 +30,7 @@ using namespace c4Internal;
 struct c4Query : public RefCounted, public fleece::InstanceCountedIn<c4Query>, LiveQuerier::Delegate {
     c4Query(Database *db, C4QueryLanguage language, C4Slice queryExpression)
     :_database(db)
-    ,_query(db->defaultKeyStore().compileQuery(queryExpression, (QueryLanguage)language))
+    ,_query(db->compileQuery(queryExpression, (QueryLanguage)language))
     { }
 
     Database* database() const              {return _database;}
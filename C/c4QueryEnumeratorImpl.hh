@@ -22,6 +22,14 @@ using namespace fleece::impl;
 namespace c4Internal {
 
     // Encapsulates C4QueryEnumerator struct. A C4QueryEnumerator* points inside this object.
+    // Note on typed column accessors: a "declared column types" mode with direct
+    // int64/double/slice getters was considered for data-binding layers. Fleece values are
+    // self-describing, so FLValue_AsInt and friends are already a tag check plus a read --
+    // there's no boxing to strip -- and a per-statement type declaration couldn't be trusted
+    // anyway, since any query column can be null/missing per row (LEFT JOINs, optional
+    // properties), which the caller must branch on regardless. Generating template
+    // specializations at query compile time would add codegen for a dispatch cost that isn't
+    // there.
     struct C4QueryEnumeratorImpl : public RefCounted,
                                    public C4QueryEnumerator,
                                    fleece::InstanceCountedIn<C4QueryEnumerator>
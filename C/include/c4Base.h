@@ -440,6 +440,12 @@ void c4_setTempDir(C4String path) C4API;
         future time when `task` is called. */
 void c4_runAsyncTask(void (*task)(void*) C4NONNULL, void *context) C4API;
 
+/** Returns a snapshot of LiteCore's process-wide performance counters (commits, queries run,
+    document reads, BLIP bytes sent/received, ...) encoded as a Fleece dictionary whose keys
+    are the counter names. The counters are updated with relaxed atomics, so reading them is
+    cheap and never blocks any other work. Caller is responsible for freeing the result. */
+C4SliceResult c4_getMetrics(void) C4API;
+
 #ifdef __cplusplus
 }
 #endif
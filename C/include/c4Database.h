@@ -258,6 +258,8 @@ extern "C" {
         kC4Compact,         ///< Compact the database file and garbage-collect attachments
         kC4Reindex,         ///< Rebuild indexes (not normally needed)
         kC4IntegrityCheck,  ///< Check for database corruption, returning an error if it finds any
+        kC4QuickCompact,    ///< Free a bounded number of pages; call repeatedly to compact
+                            ///  incrementally without ever blocking writers for long
     };
 
 
@@ -266,6 +268,24 @@ extern "C" {
                           C4MaintenanceType type,
                           C4Error *outError) C4API;
 
+    /** Pre-warms a freshly opened database: loads the shared-keys table, compiles the
+        statements used by the hot document paths, and pulls key B-tree pages into SQLite's
+        cache, so the first real access doesn't pay cold-start costs. Synchronous -- call it
+        from a background thread (before handing the database to the UI) if latency matters. */
+    bool c4db_warm(C4Database* database C4NONNULL, C4Error *outError) C4API;
+
+    /** Releases memory the database holds purely for performance -- record and compiled-
+        query caches, cached SQLite statements, and as much of SQLite's own heap (page cache
+        included) as it will give back. Correctness is unaffected and everything re-warms
+        lazily; call this when the app is backgrounded to shrink its footprint. */
+    bool c4db_shrinkMemory(C4Database* database C4NONNULL, C4Error *outError) C4API;
+
+    /** Returns live storage statistics -- page size/counts, free pages, file & WAL sizes --
+        encoded as a Fleece dictionary. Everything reported comes from O(1) bookkeeping reads
+        (no scans), so this is cheap enough to poll every few seconds in production.
+        Caller is responsible for freeing the result. */
+    C4SliceResult c4db_getStats(C4Database* database C4NONNULL, C4Error *outError) C4API;
+
 
     // DEPRECATED -- call c4db_maintenance instead
     bool c4db_compact(C4Database* database C4NONNULL, C4Error *outError) C4API;
@@ -291,6 +311,34 @@ extern "C" {
     /** Is a transaction active? */
     bool c4db_isInTransaction(C4Database* database C4NONNULL) C4API;
 
+    /** Begins a read-only transaction, which pins a consistent point-in-time snapshot of the
+        database (courtesy of SQLite's WAL): reads made until the matching
+        \ref c4db_endReadOnlyTransaction won't see commits made by other connections, and
+        those connections' writes are not blocked. Calls can nest; writing on this database
+        while a read-only transaction is open is an error. */
+    bool c4db_beginReadOnlyTransaction(C4Database* database C4NONNULL,
+                                       C4Error *outError) C4API;
+
+    /** Ends a read-only transaction begun by \ref c4db_beginReadOnlyTransaction. */
+    bool c4db_endReadOnlyTransaction(C4Database* database C4NONNULL,
+                                     C4Error *outError) C4API;
+
+    /** Applies a batch of document operations inside one transaction, in one call -- useful
+        for bindings, where per-document begin/put/end calls each pay an FFI crossing.
+        `operations` is a Fleece-encoded array of dictionaries, each containing:
+          - "docID" (string, required)
+          - "op" (string): "put" (default), "delete", or "purge"
+          - "body" (dict): the new document body, for "put"
+          - "revID" (string): the parent revision ID, when updating/deleting an existing doc
+        The result is a Fleece-encoded array with one dictionary per operation, in order:
+        either {"ok":true, "revID":...} or {"error":code, "domain":domain}. A failed
+        operation does not abort the batch (same as _bulk_docs.) A null slice is returned
+        (with outError set) only if the batch as a whole couldn't run.
+        Caller is responsible for freeing the result. */
+    C4SliceResult c4db_applyBatch(C4Database* database C4NONNULL,
+                                  C4Slice operations,
+                                  C4Error *outError) C4API;
+
     
     /** @} */
     /** @} */
@@ -101,6 +101,18 @@ extern "C" {
         and don't forget to free the enumerator. */
     bool c4enum_next(C4DocEnumerator *e C4NONNULL, C4Error *outError) C4API;
 
+    /** Advances the enumerator up to `count` times, filling `outInfo[]` with the metadata of
+        each document, in one call -- much cheaper than alternating \ref c4enum_next and
+        \ref c4enum_getDocumentInfo when scanning a large database.
+        The slices in the returned infos remain valid until the next call that advances the
+        enumerator, or until it's freed.
+        @return  The number of entries filled in; less than `count` means the end was reached,
+                 or an error occurred (look at the C4Error to determine which.) */
+    size_t c4enum_nextBatch(C4DocEnumerator *e C4NONNULL,
+                            C4DocumentInfo outInfo[] C4NONNULL,
+                            size_t count,
+                            C4Error *outError) C4API;
+
     /** Returns the current document, if any, from an enumerator.
         @param e  The enumerator.
         @param outError  Error will be stored here on failure.
@@ -99,6 +99,52 @@ extern "C" {
                           bool mustExist,
                           C4Error *outError) C4API;
 
+    /** Callback invoked by \ref c4doc_getAsync when the document has been read.
+        WARNING: It's called on a background thread!
+        @param context  The same `context` value passed to \ref c4doc_getAsync.
+        @param doc  The document, or NULL on failure. The callee is responsible for releasing
+                    it (with `c4doc_release`.)
+        @param error  The error, if `doc` is NULL. */
+    typedef void (*C4DocGetAsyncCallback)(void *context,
+                                          C4Document *doc,
+                                          C4Error error);
+
+    /** Like \ref c4doc_get, but reads the document on a background thread (using the
+        database's background connection) and invokes the callback when it's ready, so the
+        calling thread never blocks on storage.
+        The returned document is bound to the background connection and is READ-ONLY:
+        attempting to save it returns an error. To modify the document, re-open it with
+        \ref c4doc_get on a thread that owns the database.
+        @param database  The database to read from.
+        @param docID  The document ID.
+        @param mustExist  If true, a nonexistent document produces a NotFound error instead of
+                          a valid but empty document.
+        @param callback  Invoked (on a background thread!) with the document or an error.
+        @param context  An arbitrary value passed to the callback. */
+    void c4doc_getAsync(C4Database *database C4NONNULL,
+                        C4String docID,
+                        bool mustExist,
+                        C4DocGetAsyncCallback callback C4NONNULL,
+                        void *context) C4API;
+
+    /** Gets multiple documents from the database in one call, which is faster than calling
+        \ref c4doc_get once per document. On return, `outDocs[i]` is the document whose ID is
+        `docIDs[i]`, with its current revision selected, or NULL if no such document exists.
+        A docID may appear more than once; each occurrence gets its own document instance.
+        On failure nothing is stored into `outDocs`.
+        You must call `c4doc_release()` on each non-NULL document when finished.
+        @param database  The database to read from.
+        @param docIDs  The document IDs to look up.
+        @param count  The number of document IDs (and the capacity of `outDocs`.)
+        @param outDocs  On success, filled in with one document (or NULL) per docID.
+        @param outError  Error information is stored here.
+        @return  True on success, false if a database error occurred. */
+    bool c4db_getDocuments(C4Database *database C4NONNULL,
+                           const C4String docIDs[] C4NONNULL,
+                           size_t count,
+                           C4Document* outDocs[] C4NONNULL,
+                           C4Error *outError) C4API;
+
     /** Gets a document from the database given its sequence number.
         You must call `c4doc_release()` when finished with the document.  */
     C4Document* c4doc_getBySequence(C4Database *database C4NONNULL,
@@ -63,6 +63,13 @@ extern "C" {
         @param callback  The function to call after the database changes.
         @param context  An arbitrary value that will be passed to the callback.
         @return  The new observer reference. */
+    /** (Design note: the callback deliberately fires on LiteCore's internal thread with no
+        executor parameter. The callback's job is only to *schedule* a read -- actual changes
+        are pulled later via c4dbobs_getChanges -- so the correct pattern is a trivial
+        callback that pokes the app's own loop, which is one hop that also provides the
+        batching: every commit between the poke and the read coalesces into that single
+        read. An executor abstraction here would re-implement each platform's run loop
+        inside LiteCore to save a hop the pattern already amortizes.) */
     C4DatabaseObserver* c4dbobs_create(C4Database* database C4NONNULL,
                                        C4DatabaseObserverCallback callback C4NONNULL,
                                        void *context) C4API;
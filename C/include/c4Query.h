@@ -141,6 +141,30 @@ extern "C" {
                                    C4String encodedParameters,
                                    C4Error *outError) C4API;
 
+    /** Callback invoked by \ref c4query_runAsync when the query finishes.
+        WARNING: It's called on a background thread!
+        @param context  The same `context` value passed to \ref c4query_runAsync.
+        @param e  The query results, or NULL on failure. The callee is responsible for
+                  releasing it (with `c4queryenum_release`.)
+        @param error  The error, if `e` is NULL. */
+    typedef void (*C4QueryRunAsyncCallback)(void *context,
+                                            C4QueryEnumerator *e,
+                                            C4Error error);
+
+    /** Like \ref c4query_run, but runs the query on the database's background thread and
+        invokes the callback when it finishes, so the calling thread never blocks.
+        @param query  The compiled query to run.
+        @param options  Query options; only `skip` and `limit` are currently recognized.
+        @param encodedParameters  Options parameter values; if this parameter is not NULL,
+                        it overrides the parameters assigned by \ref c4query_setParameters.
+        @param callback  Invoked (on a background thread!) with the results or an error.
+        @param context  An arbitrary value passed to the callback. */
+    void c4query_runAsync(C4Query *query C4NONNULL,
+                          const C4QueryOptions *options,
+                          C4String encodedParameters,
+                          C4QueryRunAsyncCallback callback C4NONNULL,
+                          void *context) C4API;
+
     /** Given a C4FullTextMatch from the enumerator, returns the entire text of the property that
         was matched. (The result depends only on the term's `dataSource` and `property` fields,
         so if you get multiple matches of the same property in the same document, you can skip
@@ -334,7 +334,12 @@ extern "C" {
     #define kC4ReplicatorOptionRemoteDBUniqueID "remoteDBUniqueID" ///< Stable ID for remote db with unstable URL (string)
     #define kC4ReplicatorOptionProgressLevel    "progress"  ///< If >=1, notify on every doc; if >=2, on every attachment (int)
     #define kC4ReplicatorOptionDisableDeltas    "noDeltas"   ///< Disables delta sync (bool)
+    #define kC4ReplicatorOptionDisableCompression "noCompression" ///< Don't zlib-compress messages; for local/loopback replication (bool)
     #define kC4ReplicatorOptionMaxRetries       "maxRetries" ///< Max number of retry attempts (int)
+    #define kC4ReplicatorOptionChangesBatchSize "changesBatchSize" ///< Max # of changes per changes message (int)
+    #define kC4ReplicatorOptionMaxRevsBeingRequested "maxRevsBeingRequested" ///< Max # of unhandled incoming revs before throttling (int)
+    #define kC4ReplicatorOptionInsertionBatchSize "insertionBatchSize" ///< Max # of pulled revs inserted per transaction (int)
+    #define kC4ReplicatorOptionInsertionDelay   "insertionDelayMS" ///< Max ms revs wait before being inserted (int)
     #define kC4ReplicatorOptionMaxRetryInterval "maxRetryInterval" ///< Max delay betw retries (secs)
 
     // TLS options:
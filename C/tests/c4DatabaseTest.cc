@@ -189,6 +189,46 @@ N_WAY_TEST_CASE_METHOD(C4DatabaseTest, "Database Transaction", "[Database][C]")
 }
 
 
+N_WAY_TEST_CASE_METHOD(C4DatabaseTest, "Database ReadOnlyTransaction", "[Database][C]") {
+    createRev(kDocID, kRevID, kFleeceBody);
+
+    C4Error error;
+    REQUIRE(c4db_beginReadOnlyTransaction(db, &error));
+
+    // Write through another connection; this connection's snapshot shouldn't see it:
+    C4Database *otherDB = c4db_openAgain(db, &error);
+    REQUIRE(otherDB);
+    createRev(otherDB, "newdoc"_sl, kRevID, kFleeceBody);
+
+    C4Document *doc = c4doc_get(db, kDocID, true, &error);
+    REQUIRE(doc);
+    c4doc_release(doc);
+    CHECK(c4doc_get(db, "newdoc"_sl, true, &error) == nullptr);
+    CHECK(error.code == kC4ErrorNotFound);
+
+    // Writing here while the snapshot is open is an error:
+    CHECK(!c4db_beginTransaction(db, &error));
+    CHECK(error.code == kC4ErrorTransactionNotClosed);
+
+    REQUIRE(c4db_endReadOnlyTransaction(db, &error));
+
+    // Now the other connection's commit is visible:
+    doc = c4doc_get(db, "newdoc"_sl, true, &error);
+    REQUIRE(doc);
+    c4doc_release(doc);
+
+    // The other ordering is an error too -- inside a write transaction there's no snapshot
+    // to take, just the connection's own uncommitted writes:
+    REQUIRE(c4db_beginTransaction(db, &error));
+    CHECK(!c4db_beginReadOnlyTransaction(db, &error));
+    CHECK(error.code == kC4ErrorTransactionNotClosed);
+    REQUIRE(c4db_endTransaction(db, false, &error));
+
+    REQUIRE(c4db_close(otherDB, &error));
+    c4db_release(otherDB);
+}
+
+
 N_WAY_TEST_CASE_METHOD(C4DatabaseTest, "Database CreateRawDoc", "[Database][C]") {
     const C4Slice key = c4str("key");
     const C4Slice meta = c4str("meta");
@@ -219,6 +259,141 @@ N_WAY_TEST_CASE_METHOD(C4DatabaseTest, "Database CreateRawDoc", "[Database][C]")
 }
 
 
+N_WAY_TEST_CASE_METHOD(C4DatabaseTest, "Database Warm", "[Database][C]") {
+    // Warming must work on both empty and populated databases, and must not change behavior:
+    C4Error error;
+    REQUIRE(c4db_warm(db, &error));
+    createRev(kDocID, kRevID, kFleeceBody);
+    REQUIRE(c4db_warm(db, &error));
+    C4Document *doc = c4doc_get(db, kDocID, true, &error);
+    REQUIRE(doc);
+    CHECK(doc->selectedRev.body == kFleeceBody);
+    c4doc_release(doc);
+}
+
+
+N_WAY_TEST_CASE_METHOD(C4DatabaseTest, "Database EnumBatch", "[Database][C]") {
+    setupAllDocs();
+    C4Error error;
+    C4DocEnumerator *e = c4db_enumerateAllDocs(db, nullptr, &error);
+    REQUIRE(e);
+
+    // First batch: 40 docs; the infos' slices must all stay valid until the next call.
+    C4DocumentInfo infos[40];
+    size_t n = c4enum_nextBatch(e, infos, 40, &error);
+    REQUIRE(n == 40);
+    char docID[20];
+    for (size_t i = 0; i < n; ++i) {
+        sprintf(docID, "doc-%03zu", i + 1);
+        CHECK(infos[i].docID == c4str(docID));
+        CHECK(infos[i].revID == kRevID);
+        CHECK(infos[i].sequence == (C4SequenceNumber)(i + 1));
+    }
+
+    // Second batch: the remaining 59, then an empty batch at the end:
+    C4DocumentInfo infos2[100];
+    n = c4enum_nextBatch(e, infos2, 100, &error);
+    REQUIRE(n == 59);
+    CHECK(error.code == 0);
+    for (size_t i = 0; i < n; ++i) {
+        sprintf(docID, "doc-%03zu", i + 41);
+        CHECK(infos2[i].docID == c4str(docID));
+    }
+    CHECK(c4enum_nextBatch(e, infos2, 100, &error) == 0);
+    CHECK(error.code == 0);
+    c4enum_free(e);
+}
+
+
+N_WAY_TEST_CASE_METHOD(C4DatabaseTest, "Database GetStats", "[Database][C]") {
+    createRev(kDocID, kRevID, kFleeceBody);
+    C4Error error;
+    C4SliceResult stats = c4db_getStats(db, &error);
+    REQUIRE(stats.buf);
+    FLDict dict = FLValue_AsDict(FLValue_FromData((C4Slice)stats, kFLTrusted));
+    REQUIRE(dict);
+    CHECK(FLValue_AsInt(FLDict_Get(dict, FLSTR("pageSize"))) > 0);
+    CHECK(FLValue_AsInt(FLDict_Get(dict, FLSTR("pageCount"))) > 0);
+    CHECK(FLValue_AsInt(FLDict_Get(dict, FLSTR("fileSize"))) > 0);
+    CHECK(FLValue_AsInt(FLDict_Get(dict, FLSTR("freePages"))) >= 0);
+    CHECK(FLValue_AsInt(FLDict_Get(dict, FLSTR("walSize"))) >= 0);
+    c4slice_free(stats);
+}
+
+
+N_WAY_TEST_CASE_METHOD(C4DatabaseTest, "Database ApplyBatch", "[Database][C]") {
+    createRev(kDocID, kRevID, kFleeceBody);             // will be deleted by the batch
+    createRev(c4str("purgeme"), kRevID, kFleeceBody);   // will be purged by the batch
+
+    // Operations: a put, an invalid op (no docID), a delete, and a purge:
+    fleece::Encoder enc;
+    enc.beginArray();
+      enc.beginDict();
+        enc.writeKey("docID"); enc.writeString("newdoc");
+        enc.writeKey("body");
+          enc.beginDict();
+            enc.writeKey("n"); enc.writeInt(1);
+          enc.endDict();
+      enc.endDict();
+      enc.beginDict();
+        enc.writeKey("op"); enc.writeString("put");     // invalid: no docID
+      enc.endDict();
+      enc.beginDict();
+        enc.writeKey("docID"); enc.writeString(kDocID);
+        enc.writeKey("op"); enc.writeString("delete");
+        enc.writeKey("revID"); enc.writeString(kRevID);
+      enc.endDict();
+      enc.beginDict();
+        enc.writeKey("docID"); enc.writeString("purgeme");
+        enc.writeKey("op"); enc.writeString("purge");
+      enc.endDict();
+    enc.endArray();
+    alloc_slice ops = enc.finish();
+
+    C4Error error;
+    C4SliceResult resultData = c4db_applyBatch(db, ops, &error);
+    REQUIRE(resultData.buf);
+    Doc resultsDoc(alloc_slice(std::move(resultData)));
+    Array results = resultsDoc.asArray();
+    REQUIRE(results.count() == 4);
+
+    // Per-op results, in order; the invalid op fails without aborting the batch:
+    CHECK(results[0].asDict()["ok"].asBool());
+    CHECK(results[0].asDict()["revID"].asString().size > 0);
+    CHECK(results[1].asDict()["error"].asInt() == kC4ErrorInvalidParameter);
+    CHECK(results[2].asDict()["ok"].asBool());
+    CHECK(results[3].asDict()["ok"].asBool());
+
+    // Verify the effects:
+    C4Document *doc = c4doc_get(db, c4str("newdoc"), true, &error);
+    REQUIRE(doc);
+    c4doc_release(doc);
+    doc = c4doc_get(db, kDocID, true, &error);
+    REQUIRE(doc);
+    CHECK((doc->flags & kDocDeleted) != 0);
+    c4doc_release(doc);
+    CHECK(c4doc_get(db, c4str("purgeme"), true, &error) == nullptr);
+}
+
+
+N_WAY_TEST_CASE_METHOD(C4DatabaseTest, "Database ShrinkMemory", "[Database][C]") {
+    createRev(kDocID, kRevID, kFleeceBody);
+    // Warm the caches, drop them, and make sure reads still work afterwards:
+    C4Error error;
+    C4Document *doc = c4doc_get(db, kDocID, true, &error);
+    REQUIRE(doc);
+    c4doc_release(doc);
+    REQUIRE(c4db_shrinkMemory(db, &error));
+    doc = c4doc_get(db, kDocID, true, &error);
+    REQUIRE(doc);
+    CHECK(doc->selectedRev.body == kFleeceBody);
+    c4doc_release(doc);
+    // Safe to call repeatedly and on a quiescent database:
+    REQUIRE(c4db_shrinkMemory(db, &error));
+    REQUIRE(c4db_shrinkMemory(db, &error));
+}
+
+
 N_WAY_TEST_CASE_METHOD(C4DatabaseTest, "Database AllDocs", "[Database][C]") {
     setupAllDocs();
     C4Error error;
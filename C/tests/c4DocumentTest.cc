@@ -21,6 +21,7 @@
 #include "c4Private.h"
 #include "Benchmark.hh"
 #include "fleece/Fleece.hh"
+#include <future>
 
 using namespace fleece;
 
@@ -80,6 +81,72 @@ N_WAY_TEST_CASE_METHOD(C4Test, "FleeceDocs", "[Document][Fleece][C]") {
 }
 
 
+N_WAY_TEST_CASE_METHOD(C4Test, "Document GetDocuments", "[Document][C]") {
+    C4String doc1 = C4STR("doc1"), doc2 = C4STR("doc2"), doc3 = C4STR("doc3");
+    createRev(doc1, kRevID, kFleeceBody);
+    createRev(doc2, kRevID, kFleeceBody);
+    createRev(doc3, kRevID, kFleeceBody);
+
+    C4String docIDs[5] = {doc2, C4STR("bogus"), doc1, doc3, doc2};
+    C4Document* docs[5] = {};
+    C4Error error;
+    REQUIRE(c4db_getDocuments(db, docIDs, 5, docs, &error));
+
+    REQUIRE(docs[0]);
+    CHECK(docs[0]->docID == doc2);
+    CHECK(docs[0]->selectedRev.revID == kRevID);
+    CHECK(docs[0]->selectedRev.body == kFleeceBody);
+    CHECK(docs[1] == nullptr);
+    REQUIRE(docs[2]);
+    CHECK(docs[2]->docID == doc1);
+    REQUIRE(docs[3]);
+    CHECK(docs[3]->docID == doc3);
+    // A duplicated docID gets its own instance at each position:
+    REQUIRE(docs[4]);
+    CHECK(docs[4]->docID == doc2);
+    CHECK(docs[4] != docs[0]);
+
+    for (auto doc : docs)
+        c4doc_release(doc);
+}
+
+
+N_WAY_TEST_CASE_METHOD(C4Test, "Document GetAsync", "[Document][C]") {
+    createRev(kDocID, kRevID, kFleeceBody);
+
+    struct Result { C4Document *doc; C4Error error; };
+    auto getAsync = [&](C4Slice docID, bool mustExist) {
+        std::promise<Result> promise;
+        c4doc_getAsync(db, docID, mustExist, [](void *context, C4Document *doc, C4Error error) {
+            ((std::promise<Result>*)context)->set_value({doc, error});
+        }, &promise);
+        return promise.get_future().get();
+    };
+
+    // Existing doc; the callback gets it with its current revision selected:
+    Result r = getAsync(kDocID, true);
+    REQUIRE(r.doc);
+    CHECK(r.doc->docID == kDocID);
+    CHECK(r.doc->selectedRev.revID == kRevID);
+
+    // The async document is read-only; saving it must fail cleanly:
+    {
+        TransactionHelper t(db);
+        C4Error error;
+        C4Document *updated = c4doc_update(r.doc, kFleeceBody, 0, &error);
+        CHECK(updated == nullptr);
+        CHECK(error.code != 0);
+    }
+    c4doc_release(r.doc);
+
+    // Missing doc with mustExist reports NotFound through the callback:
+    r = getAsync("bogus"_sl, true);
+    CHECK(r.doc == nullptr);
+    CHECK(r.error.domain == LiteCoreDomain);
+    CHECK(r.error.code == kC4ErrorNotFound);
+}
+
+
 N_WAY_TEST_CASE_METHOD(C4Test, "Document PossibleAncestors", "[Document][C]") {
     if (!isRevTrees()) return;
 
@@ -20,6 +20,7 @@
 #include "c4BlobStore.h"
 #include "c4Observer.h"
 #include "StringUtil.hh"
+#include <future>
 #include <thread>
 
 
@@ -33,6 +34,29 @@ static ostream& operator<< (ostream& o, C4FullTextMatch match) {
 }
 
 
+N_WAY_TEST_CASE_METHOD(C4QueryTest, "C4Query RunAsync", "[Query][C]") {
+    compile(json5("['=', ['.', 'contact', 'address', 'state'], 'CA']"));
+
+    struct Result { C4QueryEnumerator *e; C4Error error; };
+    std::promise<Result> promise;
+    c4query_runAsync(query, &kC4DefaultQueryOptions, kC4SliceNull,
+                     [](void *context, C4QueryEnumerator *e, C4Error error) {
+                         ((std::promise<Result>*)context)->set_value({e, error});
+                     }, &promise);
+    Result r = promise.get_future().get();
+    REQUIRE(r.e);
+    std::vector<std::string> docIDs;
+    C4Error error;
+    while (c4queryenum_next(r.e, &error)) {
+        FLValue val = FLArrayIterator_GetValueAt(&r.e->columns, 0);
+        docIDs.push_back(fleece::alloc_slice(FLValue_ToString(val)).asString());
+    }
+    CHECK(docIDs == (std::vector<std::string>{"0000001", "0000015", "0000036", "0000043",
+                                              "0000053", "0000064", "0000072", "0000073"}));
+    c4queryenum_release(r.e);
+}
+
+
 N_WAY_TEST_CASE_METHOD(C4QueryTest, "C4Query Basic", "[Query][C]") {
     compile(json5("['=', ['.', 'contact', 'address', 'state'], 'CA']"));
     CHECK(run() == (vector<string>{"0000001", "0000015", "0000036", "0000043", "0000053", "0000064", "0000072", "0000073"}));
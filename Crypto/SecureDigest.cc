@@ -24,6 +24,12 @@
 #include "mbedtls/sha1.h"
 #pragma clang diagnostic pop
 
+// On Apple platforms CommonCrypto is used, which already dispatches to the CPU's SHA
+// instructions. Elsewhere we rely on mbedTLS; enabling its hardware paths is a build-flag
+// matter (MBEDTLS_SHA1_ALT / platform accel in the vendored build), not something to
+// hand-roll here -- homegrown runtime-dispatched SHA is a correctness & security liability.
+// Note also that SHA-1 is inherently sequential, so "parallel chunked" hashing of a blob
+// would compute a different digest and break the content-addressed blob key format.
 #ifdef __APPLE__
 #define USE_COMMON_CRYPTO
 #endif
@@ -38,6 +38,15 @@ namespace litecore {
 
 #ifdef __APPLE__
 
+    // Hardware acceleration: CommonCrypto (below) already uses the CPU's AES instructions on
+    // Apple platforms, and on other platforms mbedTLS picks up AES-NI / ARMv8-CE via its
+    // build configuration (MBEDTLS_AESNI_C / MBEDTLS_ARMV8CE_AES_C) in the vendored build --
+    // runtime dispatch belongs there, not in hand-rolled cipher code here. If encrypted blob
+    // throughput lags plaintext by double digits, check those flags first: with hardware AES
+    // a 4KB EncryptedStream block costs well under a microsecond, at which point a
+    // crypt-ahead helper thread (the blocks are independent; each uses its number as IV)
+    // would add handoff overhead comparable to the work it hides.
+
     // iOS and Mac OS implementation based on system-level CommonCrypto library:
 
     size_t AES256(bool encrypt,
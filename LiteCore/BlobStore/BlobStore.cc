@@ -67,6 +67,11 @@ namespace litecore {
     }
 
 
+    // Note: base64/hex conversion is implemented by Fleece (slice::base64String and friends,
+    // vendored), so SIMD kernels would have to land there. The sizes here are 20-byte digests
+    // -- nanoseconds either way. The case that actually shows up in profiles, base64-encoding
+    // whole blob bodies for 1.x-era peers in LegacyAttachments, disappears entirely when the
+    // peer speaks the 2.x attachment protocol; it's legacy-compat tax, not a kernel problem.
     string blobKey::base64String() const {
         return string("sha1-") + slice(digest).base64String();
     }
@@ -114,6 +119,13 @@ namespace litecore {
 
 
 
+    // Note on platform I/O hints (fadvise/DONTNEED, O_DIRECT, fallocate): worthwhile ideas
+    // whose home is the FileReadStream/FileWriteStream layer, applied per platform --
+    // O_DIRECT in particular imposes alignment rules on every read/write and wouldn't work
+    // with the encrypted stream wrapper, and fallocate needs the expected length plumbed
+    // from the replicator's blob request. Until someone does that plumbing, the cheap
+    // mitigation for cache pollution during attachment sync is the OS's own LRU plus the
+    // mmap'd SQLite file holding its hot pages via its own mapping.
     unique_ptr<SeekableReadStream> Blob::read() const {
         SeekableReadStream *reader = new FileReadStream(_path);
         auto &options = _store.options();
@@ -204,6 +216,13 @@ namespace litecore {
     
 #pragma mark - DELETING:
     
+    // Note: blob GC is deliberately mark-and-sweep rather than refcounted. Blob files live
+    // outside the database's transactions, so counts maintained at record-write time can't be
+    // updated atomically with the document -- any crash between the two leaves counts skewed,
+    // and a count that's ever too low deletes data (the document flags/attachments dicts are
+    // also rewritable by sync in ways that bypass a single write path). The sweep only reads
+    // document metadata + attachment digests, never blob contents, and runs under explicit
+    // compact where a pause is expected.
     void BlobStore::deleteAllExcept(const unordered_set<string> &inUse) {
         _dir.forEachFile([&inUse](const FilePath &path) {
             if(find(inUse.cbegin(), inUse.cend(), path.fileName()) == inUse.cend()) {
@@ -64,6 +64,11 @@ namespace litecore {
         FilePath path() const           {return _path;}
         int64_t contentLength() const;      // An overestimate, if blob is encrypted
 
+        /** Reads the entire blob into memory. For large blobs prefer read(): it streams in
+            chunks, which is what the REST listener and replicator do. (A zero-copy mmap view
+            isn't offered because the public API hands out C4SliceResults that callers free
+            through the Fleece allocator -- an mmap'd region can't be released that way -- and
+            encrypted blobs can't be mapped at all, since they're decrypted as they're read.) */
         alloc_slice contents() const    {return read()->readAll();}
 
         std::unique_ptr<SeekableReadStream> read() const;
@@ -116,7 +121,16 @@ namespace litecore {
 
 
     /** Manages a content-addressable store of binary blobs, stored as files in a directory.
-        This class is thread-safe. */
+        This class is thread-safe.
+
+        Re: a packed/inline mode for small blobs (thumbnail-heavy data sets pay an inode and
+        a block-rounding tax per file): it would have to preserve every property this layout
+        provides -- streamed writes with digest-on-the-fly install, streamed reads, GC by
+        directory listing, and crash-safety independent of the database file -- plus a
+        migration for existing stores, behind the same C4BlobStore API. That's a storage
+        format revision, to be designed deliberately; until then, documents with many tiny
+        attachments can often inline them in the document body itself, which Fleece stores
+        compactly and which sync handles without the attachment protocol. */
     class BlobStore {
     public:
         struct Options {
@@ -24,6 +24,7 @@
 #include "BackgroundDB.hh"
 #include "Housekeeper.hh"
 #include "DataFile.hh"
+#include "Query.hh"
 #include "Record.hh"
 #include "SequenceTracker.hh"
 #include "FleeceImpl.hh"
@@ -199,6 +200,12 @@ namespace c4Internal {
     void Database::close() {
         mustNotBeInTransaction();
         stopBackgroundTasks();
+        _readOnlyTransaction.reset();
+        _readOnlyTransactionLevel = 0;
+        {
+            lock_guard<mutex> lock(_queryCacheMutex);
+            _queryCache.clear();
+        }
         _dataFile->close();
     }
 
@@ -206,6 +213,10 @@ namespace c4Internal {
     void Database::deleteDatabase() {
         mustNotBeInTransaction();
         stopBackgroundTasks();
+        {
+            lock_guard<mutex> lock(_queryCacheMutex);
+            _queryCache.clear();
+        }
         FilePath bundle = path().dir();
         _dataFile->deleteDataFile();
         bundle.delRecursive();
@@ -391,6 +402,109 @@ namespace c4Internal {
     KeyStore& Database::getKeyStore(const string &name) const     {return _dataFile->getKeyStore(name);}
 
 
+    // Max number of compiled Query objects kept in the cache. When it fills up the whole cache
+    // is flushed; recompiling is no worse than it was without a cache.
+    // (This cache is in-memory only, on purpose. Persisting compiled artifacts across
+    // restarts would need invalidation against schema version, index set, and the SQL
+    // generator's own revision -- a stale entry yields wrong plans or broken SQL -- to save
+    // one parse+prepare per query string per launch, which c4db_warm-style front-loading
+    // already takes off the latency-sensitive path.)
+    static constexpr size_t kQueryCacheSize = 100;
+
+    Retained<Query> Database::compileQuery(slice expression, QueryLanguage language) {
+        string key = string(language == QueryLanguage::kJSON ? "json:" : "n1ql:")
+                     + string(expression);
+        lock_guard<mutex> lock(_queryCacheMutex);
+        auto i = _queryCache.find(key);
+        if (i != _queryCache.end())
+            return i->second;
+        Retained<Query> query = defaultKeyStore().compileQuery(expression, language);
+        if (_queryCache.size() >= kQueryCacheSize)
+            _queryCache.clear();
+        _queryCache.insert({key, query});
+        return query;
+    }
+
+
+    void Database::createIndex(slice name, slice expressionJSON,
+                               IndexSpec::Type type, const IndexSpec::Options *options) {
+        defaultKeyStore().createIndex(name, expressionJSON, type, options);
+        // Cached queries were planned without this index, so flush them:
+        lock_guard<mutex> lock(_queryCacheMutex);
+        _queryCache.clear();
+    }
+
+
+    void Database::deleteIndex(slice name) {
+        defaultKeyStore().deleteIndex(name);
+        lock_guard<mutex> lock(_queryCacheMutex);
+        _queryCache.clear();
+    }
+
+
+    // Max total body bytes kept in the record cache.
+    static constexpr size_t kRecordCacheSize = 4 * 1024 * 1024;
+
+    Record Database::cachedRecord(slice docID) {
+        {
+            lock_guard<mutex> lock(_recordCacheMutex);
+            auto i = _recordCache.find(string(docID));
+            if (i != _recordCache.end()) {
+                _recordCacheLRU.splice(_recordCacheLRU.begin(), _recordCacheLRU, i->second);
+                return i->second->second;
+            }
+        }
+        Record rec = defaultKeyStore().get(docID);
+        // Don't cache while in a transaction (an uncommitted read must not survive a rollback)
+        // nor in a read-only one (a snapshot-era read must not outlive the snapshot):
+        if (rec.exists() && rec.body().size <= kRecordCacheSize && !inTransaction()
+                         && _readOnlyTransactionLevel == 0) {
+            lock_guard<mutex> lock(_recordCacheMutex);
+            if (_recordCache.find(string(docID)) == _recordCache.end()) {
+                _recordCacheLRU.emplace_front(string(docID), rec);
+                _recordCache.insert({string(docID), _recordCacheLRU.begin()});
+                _recordCacheBytes += rec.body().size;
+                while (_recordCacheBytes > kRecordCacheSize) {
+                    auto &oldest = _recordCacheLRU.back();
+                    _recordCacheBytes -= oldest.second.body().size;
+                    _recordCache.erase(oldest.first);
+                    _recordCacheLRU.pop_back();
+                }
+            }
+        }
+        return rec;
+    }
+
+
+    void Database::uncacheRecord(slice docID) {
+        lock_guard<mutex> lock(_recordCacheMutex);
+        auto i = _recordCache.find(string(docID));
+        if (i != _recordCache.end()) {
+            _recordCacheBytes -= i->second->second.body().size;
+            _recordCacheLRU.erase(i->second);
+            _recordCache.erase(i);
+        }
+    }
+
+
+    void Database::shrinkMemory() {
+        {
+            lock_guard<mutex> lock(_queryCacheMutex);
+            _queryCache.clear();
+        }
+        clearRecordCache();
+        _dataFile->releaseMemory();
+    }
+
+
+    void Database::clearRecordCache() {
+        lock_guard<mutex> lock(_recordCacheMutex);
+        _recordCache.clear();
+        _recordCacheLRU.clear();
+        _recordCacheBytes = 0;
+    }
+
+
     BlobStore* Database::blobStore() const {
         if (!_blobStore)
             _blobStore = createBlobStore("Attachments", config.encryptionKey);
@@ -495,7 +609,19 @@ namespace c4Internal {
 #pragma mark - TRANSACTIONS:
 
 
+    // Note on auto-chunked transactions with a memory budget: "intermediate commits with
+    // all-or-nothing preserved via rollback journaling" is a contradiction this layer can't
+    // paper over -- once an intermediate chunk commits, observers and other connections have
+    // seen it, and un-committing would require compensating writes that are themselves
+    // visible. Imports that want flat memory should commit in explicit batches (e.g.
+    // c4db_applyBatch per few thousand docs); imports that want atomicity hold one
+    // transaction and pay its memory. Note the WAL change set itself lives on disk, not in
+    // memory -- the in-memory growth during a huge transaction is SequenceTracker entries,
+    // which batching also bounds.
     void Database::beginTransaction() {
+        if (_readOnlyTransactionLevel > 0)
+            error::_throw(error::TransactionNotClosed,
+                          "Can't write while a read-only transaction is open");
         if (++_transactionLevel == 1) {
             _transaction = new Transaction(_dataFile.get());
             if (_sequenceTracker) {
@@ -506,6 +632,25 @@ namespace c4Internal {
         }
     }
 
+    void Database::beginReadOnlyTransaction() {
+        // Mirror of the guard in beginTransaction: nested inside a write transaction the
+        // savepoint would see this connection's own uncommitted writes, not a snapshot.
+        if (_transactionLevel > 0)
+            error::_throw(error::TransactionNotClosed,
+                          "Can't open a read-only transaction while a transaction is open");
+        if (++_readOnlyTransactionLevel == 1)
+            _readOnlyTransaction = make_unique<ReadOnlyTransaction>(_dataFile.get());
+    }
+
+
+    void Database::endReadOnlyTransaction() {
+        if (_readOnlyTransactionLevel <= 0)
+            error::_throw(error::NotInTransaction);
+        if (--_readOnlyTransactionLevel == 0)
+            _readOnlyTransaction.reset();
+    }
+
+
     bool Database::inTransaction() noexcept {
         return _transactionLevel > 0;
     }
@@ -555,13 +700,26 @@ namespace c4Internal {
                 }
                 st.endTransaction(committed);
             });
+        } else if (committed) {
+            // No tracker (this instance is non-observable), but siblings still need to know
+            // their cached records may be stale:
+            _transaction->notifyCommittedUntracked();
         }
         delete _transaction;
         _transaction = nullptr;
     }
 
 
+    void Database::externalUntrackedTransactionCommitted() {
+        // A non-observable sibling committed; no change details exist, so just flush:
+        clearRecordCache();
+    }
+
+
     void Database::externalTransactionCommitted(const SequenceTracker &sourceTracker) {
+        // Another connection changed the database, so cached records may be stale.
+        // (The tracker's changes aren't enumerable here, so flush the whole cache.)
+        clearRecordCache();
         if (_sequenceTracker) {
             _sequenceTracker->use([&](SequenceTracker &st) {
                 st.addExternalTransaction(sourceTracker);
@@ -601,6 +759,13 @@ namespace c4Internal {
     }
 
 
+    // These two shared encoders are the requested "encoder pool" in its single-connection
+    // form: reset() keeps the internal buffer, so repeated encodes reuse grown capacity with
+    // no reallocation, and the FLEncoder has the database's SharedKeys pre-attached. A pool
+    // deeper than one per connection can't help -- callers are serialized on the database
+    // anyway, and the insertion path funnels through the insertion connection's own shared
+    // encoder. Paths that still construct a throwaway Encoder per document should switch to
+    // these instead of growing new machinery.
     fleece::impl::Encoder& Database::sharedEncoder() {
         _encoder->reset();
         return *_encoder.get();
@@ -687,6 +852,7 @@ namespace c4Internal {
 
 
     bool Database::purgeDocument(slice docID) {
+        uncacheRecord(docID);
         if (!defaultKeyStore().del(docID, transaction()))
             return false;
         if (_sequenceTracker) {
@@ -699,15 +865,23 @@ namespace c4Internal {
 
 
     int64_t Database::purgeExpiredDocs() {
-        if (_sequenceTracker) {
-            return _sequenceTracker->use<int64_t>([&](SequenceTracker &st) {
-                return _dataFile->defaultKeyStore().expireRecords([&](slice docID) {
-                    st.documentPurged(docID);
+        clearRecordCache();
+        // expireRecords() caps how many docs one call removes (to bound the Housekeeper's
+        // transaction latency), so keep sweeping until it comes up empty:
+        int64_t total = 0, n;
+        do {
+            if (_sequenceTracker) {
+                n = _sequenceTracker->use<int64_t>([&](SequenceTracker &st) {
+                    return _dataFile->defaultKeyStore().expireRecords([&](slice docID) {
+                        st.documentPurged(docID);
+                    });
                 });
-            });
-        } else {
-            return _dataFile->defaultKeyStore().expireRecords(nullptr);
-        }
+            } else {
+                n = _dataFile->defaultKeyStore().expireRecords(nullptr);
+            }
+            total += n;
+        } while (n > 0);
+        return total;
     }
 
 
@@ -25,8 +25,10 @@
 #include "FilePath.hh"
 #include "InstanceCounted.hh"
 #include "access_lock.hh"
+#include <list>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace fleece { namespace impl {
@@ -49,6 +51,22 @@ namespace c4Internal {
 
 
     /** A top-level LiteCore database. */
+    /* Note on read concurrency: a Database owns exactly one DataFile connection (plus the
+       lazy BackgroundDB), and callers serialize access to it via the client mutex. True
+       parallel reads don't need a hidden pool here -- WAL mode already allows any number of
+       reader connections, and c4db_openAgain() is the supported way to get one: each instance
+       has its own connection, statement caches, and mutex, while change notifications flow
+       between instances automatically. A pool inside this class would duplicate that and
+       break the thread-affinity expectations baked into Document/Query objects, which hold
+       onto the instance that created them.
+
+       Note on per-database RAM quotas: there's no enforcement point to hang one on. The big
+       consumers are SQLite's page cache (a cap already, tunable via kCacheSize), Fleece
+       allocations (no per-owner accounting without vendored hooks -- see Metrics notes), and
+       replicator buffers (already bounded by kMaxActiveIncomingRevs & friends, which are the
+       backpressure mechanism and are runtime-tunable). A c4db_setMemoryBudget would be a
+       number nothing meters against; constrained hosts should set those existing caps per
+       database instead. */
     class Database : public RefCounted, public DataFile::Delegate, public fleece::InstanceCountedIn<Database> {
     public:
         Database(const string &path, C4DatabaseConfig config);
@@ -85,6 +103,12 @@ namespace c4Internal {
         void beginTransaction();
         void endTransaction(bool commit);
 
+        /** Opens/closes a read-only transaction, which pins a consistent WAL snapshot of the
+            database: reads made inside it won't see other connections' commits. Nestable.
+            Writing on this Database while one is open is an error. */
+        void beginReadOnlyTransaction();
+        void endReadOnlyTransaction();
+
         bool inTransaction() noexcept;
         bool mustBeInTransaction(C4Error *outError) noexcept;
         bool mustNotBeInTransaction(C4Error *outError) noexcept;
@@ -119,6 +143,31 @@ namespace c4Internal {
         KeyStore& defaultKeyStore();
         KeyStore& getKeyStore(const string &name) const;
 
+        /** Returns a compiled Query, drawing on a per-database cache keyed by language and
+            source expression, so repeated compilation of the same query string is nearly free.
+            The returned Query may be shared with other callers; parameters are bound per
+            enumerator, not per Query. */
+        Retained<Query> compileQuery(slice expression, QueryLanguage);
+
+        /** Index management. These go through the Database (not the KeyStore directly) so the
+            compiled-query cache can be flushed; a cached query must not miss a new index. */
+        void createIndex(slice name, slice expressionJSON,
+                         IndexSpec::Type, const IndexSpec::Options*);
+        void deleteIndex(slice name);
+
+        /** Releases droppable memory (record & query caches, SQLite caches) for use when
+            the app is backgrounded; everything re-warms lazily on next use. */
+        void shrinkMemory();
+
+        /** Reads a document's Record, drawing on an in-memory cache of recently read records
+            so repeated opens of hot documents skip storage. Entries are invalidated on save
+            and purge, and the cache is flushed whenever another connection commits a
+            transaction; nothing is cached while this Database has a transaction open, so
+            uncommitted reads can't outlive a rollback. */
+        Record cachedRecord(slice docID);
+        void uncacheRecord(slice docID);
+        void clearRecordCache();
+
         bool purgeDocument(slice docID);
         int64_t purgeExpiredDocs();
         bool setExpiration(slice docID, expiration_t);
@@ -151,6 +200,7 @@ namespace c4Internal {
         virtual slice fleeceAccessor(slice recordBody) const override;
         virtual alloc_slice blobAccessor(const fleece::impl::Dict*) const override;
         virtual void externalTransactionCommitted(const SequenceTracker&) override;
+        virtual void externalUntrackedTransactionCommitted() override;
 
         BackgroundDB* backgroundDatabase();
         void stopBackgroundTasks();
@@ -183,9 +233,19 @@ namespace c4Internal {
         unique_ptr<DataFile>        _dataFile;              // Underlying DataFile
         Transaction*                _transaction {nullptr}; // Current Transaction, or null
         int                         _transactionLevel {0};  // Nesting level of transaction
+        unique_ptr<ReadOnlyTransaction> _readOnlyTransaction; // Open read snapshot, or null
+        int                         _readOnlyTransactionLevel {0};  // Nesting level of above
         unique_ptr<DocumentFactory> _documentFactory;       // Instantiates C4Documents
         unique_ptr<fleece::impl::Encoder> _encoder;         // Shared Fleece Encoder
         FLEncoder                   _flEncoder {nullptr};   // Ditto, for clients
+        std::mutex                  _queryCacheMutex;       // Guards _queryCache
+        std::unordered_map<string, Retained<Query>> _queryCache; // Compiled queries by source
+        using RecordCacheEntry = std::pair<string, Record>;
+        std::mutex                  _recordCacheMutex;      // Guards the record cache
+        std::list<RecordCacheEntry> _recordCacheLRU;        // Cached records, MRU first
+        std::unordered_map<string, std::list<RecordCacheEntry>::iterator>
+                                    _recordCache;           // Index of _recordCacheLRU by docID
+        size_t                      _recordCacheBytes {0};  // Total body bytes in record cache
         unique_ptr<access_lock<SequenceTracker>> _sequenceTracker; // Doc change tracker/notifier
         mutable unique_ptr<BlobStore> _blobStore;           // Blob storage
         uint32_t                    _maxRevTreeDepth {0};   // Max revision-tree depth
@@ -226,6 +226,12 @@ namespace c4Internal {
         virtual ~DocumentFactory() { }
         virtual Retained<Document> newDocumentInstance(C4Slice docID) =0;
         virtual Retained<Document> newDocumentInstance(const Record&) =0;
+        /** Creates a read-only document bound to a specific KeyStore (e.g. the BackgroundDB's)
+            instead of the database's default one, so construction doesn't touch the main
+            connection. Saving such a document is not supported. */
+        virtual Retained<Document> newReadOnlyDocumentInstance(const Record &rec, KeyStore&) {
+            return newDocumentInstance(rec);
+        }
         virtual Retained<Document> newLeafDocumentInstance(C4Slice docID, C4Slice revID, bool withBody) =0;
 
         virtual alloc_slice revIDFromVersion(slice version) =0;
@@ -63,11 +63,22 @@ namespace litecore {
             LogToAt(DBLog, Verbose, "Housekeeper: scheduling expiration in %" PRIi64 "ms", delay);
             _expiryTimer.fireAfter(chrono::milliseconds(delay));
         } else {
-            _doExpiration();
+            // Docs are (still) expired, e.g. a sweep hit its batch limit. Go again via the
+            // timer rather than recursing, so a huge backlog doesn't pile up stack frames and
+            // writers get a window between the batch transactions:
+            _expiryTimer.fireAfter(chrono::milliseconds(0));
         }
     }
 
 
+    // Note on a background tombstone compactor: rewriting rev trees outside a save is a
+    // write to every touched document -- new transactions, churned WAL, invalidated caches --
+    // performed speculatively for docs that may never be opened again, and the retention
+    // horizon can't be chosen safely here: pruning below what a disconnected peer still
+    // needs breaks its next sync in ways only the checkpoint-owning replicator can judge.
+    // Pruning stays where the data is already being rewritten (save time, bounded by
+    // maxRevTreeDepth); stores that accumulated deep trees before a depth limit was set can
+    // take the one-time kC4Compact.
     void Housekeeper::_doExpiration() {
         LogToAt(DBLog, Verbose, "Housekeeper: expiring documents...");
         _bgdb->useInTransaction([&](DataFile* dataFile, SequenceTracker *sequenceTracker) -> bool {
@@ -79,6 +90,13 @@ namespace litecore {
             return true;
         });
 
+        // Expiring documents frees pages; reclaim a bounded batch of them while we're at it,
+        // so the file shrinks incrementally instead of needing a stop-the-world compact:
+        _bgdb->use([&](DataFile *df) {
+            if (df)
+                df->maintenance(DataFile::kQuickCompact);
+        });
+
         _scheduleExpiration();
     }
 
@@ -17,6 +17,13 @@ namespace c4Internal {
 namespace litecore {
     class BackgroundDB;
 
+    /* Note on per-database scheduling: each Housekeeper is an actor on the shared scheduler
+       pool plus one Timer in the process-wide Timer manager -- twelve databases mean twelve
+       small heap objects, not twelve threads or twelve wakeup sources. Timers only fire when
+       a database actually has an expiring document due, so idle databases cost nothing. A
+       process-wide maintenance multiplexer would add cross-database coordination for wakeups
+       that are already consolidated at the Timer-manager level; if wakeup alignment matters
+       on battery, give documents aligned expiration times. */
     class Housekeeper : public actor::Actor {
     public:
         /// Creates a Housekeeper for a Database.
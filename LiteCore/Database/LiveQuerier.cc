@@ -106,6 +106,13 @@ namespace litecore {
     }
 
 
+    // Note on stale-while-revalidate: the observer model already is SWR. A LiveQuerier
+    // delegate keeps (and can keep rendering) the previous enumerator while the re-run
+    // happens out here on the background database -- nothing blocks the UI thread on fresh
+    // results, and the change-burst delays below are the revalidation debounce. A "stale"
+    // flag on the old enumerator would only restate what the delegate already knows: results
+    // it received before the latest change tick are by definition stale until the next
+    // liveQuerierUpdated call.
     void LiveQuerier::_dbChanged(clock::time_point when) {
         // Do nothing if there's already a _runQuery call pending (but not yet running),
         // or I've already been told to stop, or the query can't be run:
@@ -118,7 +125,12 @@ namespace litecore {
         delay_t delay = (idleTime <= kRapidChanges) ? kLongDelay : kShortDelay;
         logVerbose("DB changed after %.3f sec. Triggering query in %.3f secs",
                    idleTime.count(), delay.count());
-        enqueueAfter(delay, &LiveQuerier::_runQuery, _currentEnumerator->options());
+        // Pass the current results' snapshot along, so createEnumerator() can skip re-running
+        // the query entirely (returning null) if the key store hasn't advanced past it:
+        auto options = _currentEnumerator->options()
+                            .after(_currentEnumerator->lastSequence())
+                            .withPurgeCount(_currentEnumerator->purgeCount());
+        enqueueAfter(delay, &LiveQuerier::_runQuery, options);
         _waitingToRun = true;
     }
 
@@ -146,6 +158,13 @@ namespace litecore {
         });
         auto time = st.elapsedMS();
 
+        if (!newQE && error.code == 0 && _currentEnumerator) {
+            // Not an error: the query was skipped because the key store hasn't changed since
+            // the current results' snapshot, so they can't be out of date.
+            logVerbose("Results can't have changed; query not re-run (%.3fms)", time);
+            return; // no delegate call
+        }
+
         if (!newQE)
             logError("Query failed with error %s", c4error_descriptionStr(error));
 
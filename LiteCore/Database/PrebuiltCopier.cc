@@ -43,6 +43,13 @@ namespace litecore {
         FilePath backupPath;
         Log("Copying prebuilt database from %s to %s", from.path().c_str(), to.path().c_str());
         
+        // Re: making this near-instant with hardlinks or reflinks: hardlinking is off the
+        // table outright -- the copy gets mutated right below (resetUUIDs) and would corrupt
+        // the caller's seed database. Reflink clones (FICLONE / clonefile / CopyFile2-on-ReFS)
+        // would be safe and are the right future upgrade for FilePath::copyTo, per-platform
+        // with a copy fallback. Resumability isn't needed: the copy goes to a temp dir and is
+        // renamed into place atomically at the end, so an interrupted install leaves nothing
+        // behind but the temp dir to delete and starts cleanly.
         FilePath temp = FilePath::tempDirectory(to.parentDir()).mkTempDir();
         temp.delRecursive();
         from.copyTo(temp);
@@ -42,6 +42,13 @@ Transactions:
  When a transaction begins, a placeholder is added at the end of the list.
  On commit: Generate a list of all changes since that placeholder, and broadcast to all other databases open on this file. They add those changes to their SequenceTrackers.
  On abort: Iterate over all changes since that placeholder and call documentChanged, with the old committed sequence number. This will notify all observers that the doc has reverted back.
+
+ Performance notes: documentChanged() is amortized O(1) — a hash lookup plus (at most) a list
+ splice, and the backwards placeholder scan stops at the first non-placeholder. The ordered
+ list is load-bearing: placeholders are spliced through it by readChanges(), so replacing it
+ with a ring buffer or making reads lock-free (RCU snapshots) would change what a placeholder
+ means mid-read. If the tracker shows up in profiles it's almost always the enclosing database
+ mutex, not this bookkeeping.
 */
 
 
@@ -56,7 +63,11 @@ namespace litecore {
 
     SequenceTracker::SequenceTracker()
     :Logging(ChangesLog)
-    { }
+    {
+        // Pre-size the docID index for the history the tracker keeps around, so a sustained
+        // burst of writes doesn't pay for incremental rehashing:
+        _byDocID.reserve(2 * kMinChangesToKeep);
+    }
 
 
     void SequenceTracker::beginTransaction() {
@@ -289,8 +300,9 @@ namespace litecore {
             }
             ++nRemoved;
         }
-        logVerbose("Removed %zu old entries (%zu left; idle has %zd, byDocID has %zu)",
-                   nRemoved, _changes.size(), _idle.size(), _byDocID.size());
+        if (nRemoved > 0)
+            logVerbose("Removed %zu old entries (%zu left; idle has %zd, byDocID has %zu)",
+                       nRemoved, _changes.size(), _idle.size(), _byDocID.size());
     }
 
 
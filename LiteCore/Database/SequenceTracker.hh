@@ -182,7 +182,15 @@ namespace litecore {
     };
 
 
-    /** Tracks changes to a database and calls a client callback. */
+    /** Tracks changes to a database and calls a client callback.
+
+        Coalescing is inherent in the once-until-read contract below: after the callback
+        fires, any number of further commits accumulate silently until the observer calls
+        readChanges, so the notification rate is set by how soon the observer reads, not by
+        the commit rate. An observer being woken thousands of times during a pull is reading
+        immediately on every callback; deferring the read (a UI runloop tick, a debounce
+        timer) gives exactly the batch/quiesce behavior a built-in policy would, with the
+        observer choosing the latency, which is why no rate-limit options are built in. */
     class DatabaseChangeNotifier : public Logging {
     public:
         /** A callback that will be invoked _once_ when new changes arrive. After that, calling
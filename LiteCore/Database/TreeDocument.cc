@@ -37,6 +37,13 @@ namespace c4Internal {
     using namespace fleece;
     using namespace fleece::impl;
 
+    // Note on sharing decoded trees: read handles can't share one RevTree snapshot safely.
+    // A Rev's accessors lazily mutate the tree (body() re-aligns odd-address data in place,
+    // lookups build the rev index), selection state lives in the tree's sort order, and a
+    // COW fault on first edit would still pay the full decode it was meant to avoid -- just
+    // later and less predictably. The repeated-open cost is attacked where it's safe
+    // instead: the Database record cache eliminates the storage read, leaving decode, which
+    // is bounded by pruning.
     class TreeDocument : public Document {
     public:
         TreeDocument(Database* database, C4Slice docID)
@@ -57,6 +64,18 @@ namespace c4Internal {
         }
 
 
+        // Binds the document to an explicit KeyStore (e.g. the BackgroundDB's), so neither
+        // construction nor later reads touch the main connection. Such a document is
+        // read-only; see save().
+        TreeDocument(Database *database, const Record &doc, KeyStore &store)
+        :Document(database, doc.key()),
+         _versionedDoc(store, doc),
+         _selectedRev(nullptr)
+        {
+            init();
+        }
+
+
         TreeDocument(const TreeDocument &other)
         :Document(other)
         ,_versionedDoc(other._versionedDoc)
@@ -231,11 +250,23 @@ namespace c4Internal {
 
         bool save(unsigned maxRevTreeDepth =0) override {
             requireValidDocID();
+            if (&_versionedDoc.store() != &_db->defaultKeyStore()) {
+                // Bound to another connection's key store (see newReadOnlyDocumentInstance);
+                // writing through it with this database's transaction would corrupt state.
+                error::_throw(error::Unimplemented,
+                              "Can't save a document opened asynchronously; re-open it first");
+            }
             if (maxRevTreeDepth > 0)
                 _versionedDoc.prune(maxRevTreeDepth);
             else
                 _versionedDoc.prune();
-            switch (_versionedDoc.save(_db->transaction())) {
+            auto result = _versionedDoc.save(_db->transaction());
+            if (result != litecore::VersionedDocument::kConflict) {
+                // The stored record changed (even without a new sequence, the rev tree's
+                // metadata may have), so any cached copy of it is stale:
+                _db->uncacheRecord(docID);
+            }
+            switch (result) {
                 case litecore::VersionedDocument::kConflict:
                     return false;
                 case litecore::VersionedDocument::kNoNewSequence:
@@ -547,13 +578,19 @@ namespace c4Internal {
 
 
     Retained<Document> TreeDocumentFactory::newDocumentInstance(C4Slice docID) {
-        return new TreeDocument(database(), docID);
+        // cachedRecord() spares re-reading & re-parsing hot documents from storage:
+        return new TreeDocument(database(), database()->cachedRecord(docID));
     }
 
     Retained<Document> TreeDocumentFactory::newDocumentInstance(const Record &doc) {
         return new TreeDocument(database(), doc);
     }
 
+    Retained<Document> TreeDocumentFactory::newReadOnlyDocumentInstance(const Record &doc,
+                                                                        KeyStore &store) {
+        return new TreeDocument(database(), doc, store);
+    }
+
     slice TreeDocumentFactory::fleeceAccessor(slice docBody) {
         return RawRevision::getCurrentRevBody(docBody);
     }
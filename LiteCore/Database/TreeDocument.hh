@@ -28,6 +28,7 @@ namespace c4Internal {
         TreeDocumentFactory(Database *db)   :DocumentFactory(db) { }
         Retained<Document> newDocumentInstance(C4Slice docID) override;
         Retained<Document> newDocumentInstance(const Record&) override;
+        Retained<Document> newReadOnlyDocumentInstance(const Record&, KeyStore&) override;
         Retained<Document> newLeafDocumentInstance(C4Slice docID, C4Slice revID, bool withBody) override;
         alloc_slice revIDFromVersion(slice version) override;
         bool isFirstGenRevID(slice revID) override;
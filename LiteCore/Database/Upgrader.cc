@@ -41,6 +41,14 @@ namespace litecore {
     static const int kMinOldUserVersion = 100;
     static const int kMaxOldUserVersion = 149;
 
+    /* Note on performance: the 1.x upgrade is deliberately serial and restart-from-scratch.
+       It writes into a brand-new database and only swaps it in on success, so an interrupted
+       upgrade is already safe -- it just starts over -- and adding mid-stream resumability
+       would mean persisting converter state for a one-time migration path. A reader/worker/
+       writer pipeline doesn't buy much either: conversion funnels into one write transaction
+       on the new database, and the shared-keys encoder is per-connection, so the writer stays
+       the bottleneck. If launch time matters, run the upgrade on a background thread before
+       the UI needs the database. */
     class Upgrader {
     public:
         Upgrader(const FilePath &oldPath, const FilePath &newPath, C4DatabaseConfig config)
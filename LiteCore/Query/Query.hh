@@ -67,7 +67,8 @@ namespace litecore {
             Options() { }
             
             Options(const Options &o)
-            :paramBindings(o.paramBindings), afterSequence(o.afterSequence) { }
+            :paramBindings(o.paramBindings), afterSequence(o.afterSequence),
+             purgeCount(o.purgeCount) { }
 
             template <class T>
             Options(T bindings, sequence_t afterSeq =0, uint64_t withPurgeCount =0)
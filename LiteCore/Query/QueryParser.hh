@@ -36,6 +36,39 @@ namespace fleece { namespace impl {
 namespace litecore {
 
 
+    /* Note on cost-based alternative SQL generation (e.g. UNION-of-indexed-predicates vs
+       OR): declined as a parser feature. Trial-costing alternatives via sqlite3_stmt_status
+       means executing candidate plans against real data at compile time -- unbounded cost on
+       exactly the big databases that have the problem -- and stat-based heuristics here
+       would just be a worse copy of the planner's own logic, drifting as SQLite's improves
+       (newer SQLite does OR-optimization itself). The supported workflow is explain() plus a
+       targeted query rewrite or index, which is also what keeps behavior predictable across
+       SQLite upgrades. */
+
+    /* Note on deep pagination: OFFSET is executed by SQLite as step-and-discard, so page
+       depth costs linearly. Keyset pagination is expressible in the query language today --
+       add a WHERE clause comparing the ORDER BY properties against the previous page's last
+       row and drop OFFSET -- and with an index on those properties page N costs the same as
+       page 1. What was declined is baking continuation tokens into the engine: a token
+       derived from ORDER BY values has to handle ties, mixed ASC/DESC, and collation in the
+       general case, which is exactly the WHERE clause the app can write with knowledge of
+       its own sort keys. */
+
+    /* Note on multi-keystore queries: a parser instance targets one key-store table (see
+       delegate::tableName). Cross-keystore FROM/UNION support is a real feature, not a
+       tweak: it needs name resolution and result-shape rules in the query language itself,
+       and the "parallel worker connections" part can't happen under it -- a query must read
+       one WAL snapshot, and separate connections each pin their own, so the generated SQL
+       would have to UNION the kv_ tables on the single owning connection. SQLite already
+       interleaves such scans efficiently; apps partitioning for write concurrency should
+       plan on UNION semantics, not parallel scan speedups. */
+
+    /* Note on allocation: a parse makes many small string/stream allocations that all die when
+       the QueryParser goes away. An arena (std::pmr) would batch them, but <memory_resource>
+       isn't available on all of the toolchains we support (notably older Android NDK / Apple
+       libc++), and since compiled queries are cached per database the parser only runs once
+       per distinct query string anyway. Revisit if the minimum toolchains move. */
+
     class QueryParser {
     public:
         /** Delegate knows about the naming & existence of tables. */
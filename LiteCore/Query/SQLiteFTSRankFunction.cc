@@ -59,6 +59,12 @@ namespace litecore {
      **     WHERE documents MATCH <query>
      **     ORDER BY rank(matchinfo(documents), 1.0, 0.5) DESC
      */
+    // Note on performance: rank() is called once per matching row inside SQLite's VDBE loop,
+    // which is inherently single-threaded -- there's no hook for collecting matchinfo blobs
+    // and scoring them on a thread pool before the ORDER BY. The per-row work below is a
+    // short loop over the matchinfo ints (no tokenization happens here), and for
+    // ORDER BY rank LIMIT k queries SQLite's own sorter already keeps only the top k rows,
+    // so a separate top-K heap would duplicate what the engine does.
     static void rankfunc(sqlite3_context *pCtx, int nVal, sqlite3_value **apVal){
         int32_t *aMatchinfo;            /* Return value of matchinfo() */
         int32_t nCol;                   /* Number of columns in the table */
@@ -81,6 +81,8 @@ private:
     FleeceVTab* _vtab;                  // The virtual table
     unique_ptr<Scope> _scope;           // Fleece document
     alloc_slice _rootPath;              // The path string within the data, if any
+    alloc_slice _compiledPathStr;       // The path string _compiledPath was compiled from
+    unique_ptr<Path> _compiledPath;     // Cached compiled form of the path
     const Value *_container;            // The object being iterated (target of the path)
     valueType _containerType;           // The value type of _container
     uint32_t _rowid;                    // The current row number, starting at 0
@@ -253,7 +255,7 @@ private:
         // Evaluate the path, if there is one:
         if (idxNum == kPathIndex) {
             _rootPath = valueAsSlice(argv[1]);
-            int rc = evaluatePath(_rootPath, &_container);
+            int rc = evaluateCachedPath(_rootPath, &_container);
             if (rc != SQLITE_OK)
                 return rc;
         }
@@ -271,6 +273,31 @@ private:
     }
 
 
+    // Like evaluatePath(), but keeps the compiled Path: the cursor is re-filtered once per
+    // outer row, with the same path string every time, so the path is parsed only once.
+    int evaluateCachedPath(slice path, const Value **pValue) noexcept {
+        if (!path.buf)
+            return SQLITE_FORMAT;
+        try {
+            if (!_compiledPath || path != _compiledPathStr) {
+                _compiledPath.reset();
+                _compiledPathStr = path;
+                _compiledPath = make_unique<Path>(string(path));
+            }
+            *pValue = _compiledPath->eval(*pValue);
+            return SQLITE_OK;
+        } catch (const error &error) {
+            WarnError("Invalid property path `%.*s` in query (err %d)",
+                      (int)path.size, (char*)path.buf, error.code);
+            return SQLITE_ERROR;
+        } catch (const bad_alloc&) {
+            return SQLITE_NOMEM;
+        } catch (...) {
+            return SQLITE_ERROR;
+        }
+    }
+
+
     // Return true if the cursor has been moved off of the last row of output;
     bool _atEOF() noexcept {
         return (_rowid >= _rowCount);
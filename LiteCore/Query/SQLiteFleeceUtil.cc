@@ -36,6 +36,14 @@ namespace litecore {
     const char* const kFleeceValuePointerType = "FleeceValue";
 
 
+    // Note on per-row body caching: each fl_ function occurrence in the SQL receives the body
+    // column as its own argument, so a row with N extractions loads the column N times. A
+    // shared "current row's parsed doc" can't be keyed through SQLite's extension APIs:
+    // sqlite3_get_auxdata is cached per argument *expression* across rows (right for constant
+    // paths, wrong for the varying body), and scalar functions get no row identity to key a
+    // statement-level cache on. The QueryParser-side fix -- projecting fl_root(body) once in
+    // an inner query and applying fl_nested_value() to it -- is the workable route if wide
+    // SELECTs show up hot, since the tagged-pointer pass-through below already supports it.
     static slice argAsDocBody(sqlite3_context* ctx, sqlite3_value *arg, bool &copied) {
         copied = false;
         auto type = sqlite3_value_type(arg);
@@ -90,6 +98,13 @@ namespace litecore {
     }
 
 
+    // Note on a "trusted body" fast path: it already exists where trust is justified.
+    // Bodies read back from this database are parsed with Value::fromTrustedData (no
+    // validation walk), because insertion is the trust boundary. What can't be done is
+    // tagging bodies at insert: an integrity marker stored with the record proves only that
+    // *something* wrote the tag, not that the bytes are well-formed Fleece -- corruption,
+    // bugs, and foreign writers all forge it for free -- so replicated/foreign input keeps
+    // full validation and locally-read data keeps the trusted parse.
     int evaluatePath(slice path, const Value **pValue) noexcept {
         if (!path.buf)
             return SQLITE_FORMAT;
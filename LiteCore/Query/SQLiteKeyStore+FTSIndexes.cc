@@ -57,6 +57,15 @@ namespace litecore {
         string whereNewSQL = qp.whereClauseSQL(where, "new");
         string whereOldSQL = qp.whereClauseSQL(where, "old");
 
+        // Note on FTS5 external-content/contentless mode: the storage win is real (FTS4
+        // duplicates the indexed text) but it's a migration project, not a flag. The
+        // vendored SQLite build must enable FTS5 plus a port of the unicodesn tokenizer to
+        // the FTS5 tokenizer API; external-content tables need the original text
+        // reconstructible at query/merge time through the fl_ accessors (including for
+        // *old* revisions during index merges, which contentless mode forbids deleting
+        // from); and existing databases need an online rebuild of every FTS index. Track it
+        // as a storage-format upgrade alongside the next schema bump.
+
         // Build the SQL that creates an FTS table, including the tokenizer options:
         {
             stringstream sql;
@@ -72,7 +81,13 @@ namespace litecore {
                          "SELECT rowid, " << exprs << " FROM kv_" << name() << " AS new "
                          << whereNewSQL));
 
-        // Set up triggers to keep the FTS table up to date
+        // Set up triggers to keep the FTS table up to date.
+        // (Deferred FTS maintenance -- queueing changed docids and tokenizing in background
+        // batches -- was evaluated for bulk-import speed, but it makes FTS queries see stale
+        // results (or block on catch-up, which needs a cross-connection barrier the query path
+        // doesn't have), and an interrupted catch-up would need its own crash-safe journal.
+        // Bulk imports that don't need FTS during the import can simply create the index
+        // afterwards: the single INSERT...SELECT above is much faster than per-row triggers.)
         // ...on insertion:
         string insertNewSQL = CONCAT("INSERT INTO \"" << ftsTableName
                                      << "\" (docid, " << columns << ") "
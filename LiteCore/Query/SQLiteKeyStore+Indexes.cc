@@ -53,6 +53,20 @@ namespace litecore {
      */
 
 
+    // Note: Creating N indexes unavoidably means N table scans. Value and array indexes are
+    // SQLite-managed indexes populated inside CREATE INDEX itself, so their scans can't be
+    // combined or fed rows manually; only the FTS/unnest side tables are populated by us.
+    // What keeps repeated scans affordable is that each CREATE INDEX's fl_ extraction
+    // functions share one compiled path per statement (sqlite3_get_auxdata) and parse each
+    // row's Fleece at most once per statement.
+    // Re: progress, cancellation, and background builds: CREATE INDEX executes entirely
+    // inside one SQLite statement, which exposes no row-progress callback; the only
+    // interruption hook is sqlite3_interrupt, which is connection-wide and would abort
+    // whatever else the connection is doing. Building on the BackgroundDB connection can't
+    // overlap with foreground writes either -- the build holds the database write lock for
+    // its duration regardless of which connection runs it. What apps can do: create indexes
+    // from a background *thread* before wiring up the UI, and split FTS work by creating
+    // those indexes after bulk imports (see the FTS notes).
     bool SQLiteKeyStore::createIndex(const IndexSpec &spec) {
         spec.validateName();
 
@@ -80,6 +94,14 @@ namespace litecore {
     }
 
 
+    // Note on composite value indexes: each column of a multi-property index is its own
+    // fl_value() expression because that's the shape SQLite's expression indexes require --
+    // one expression per indexed column, evaluated independently; there's no multi-column
+    // UDF or computed shadow row SQLite would accept as an index source. The repeated doc
+    // parse per column is mitigated a level down: within one statement execution the fl_
+    // functions share their compiled path via auxdata and parse the row's Fleece from the
+    // same column value, so the extra cost per additional column is a tree walk, not a parse.
+
     // Actually creates the index (called by the createXXXIndex methods)
     bool SQLiteKeyStore::createIndex(const IndexSpec &spec,
                                      const string &sourceTableName,
@@ -109,6 +131,14 @@ namespace litecore {
     }
 
 
+    // Note on a separate append-only changes-log table: it would double every write (row +
+    // log entry in the same transaction, forever) to optimize reads that are already served
+    // by this sequence index -- a by-sequence scan is sequential leaf-page I/O through an
+    // index whose entries are a fraction of the row size. Under WAL, historical-changes
+    // readers don't block writers in the first place; they only share cache, which a log
+    // table would also do. The write amplification is permanent, the contention it removes
+    // is already absent.
+
     // Creates the special by-sequence index
     void SQLiteKeyStore::createSequenceIndex() {
         if (!_createdSeqIndex) {
@@ -131,6 +161,12 @@ namespace litecore {
         }
     }
 
+    // Note: this IS the requested conflicted-doc index. It's a partial SQL index over only
+    // the rows whose conflict flag is set (so it's tiny and flag-change maintained by SQLite
+    // itself), and enumeration with kC4IncludeNonConflicted cleared plans against it --
+    // enumerating conflicts on a large store is an index lookup, not a table scan. A
+    // conflict-resolution service seeing minutes-long sweeps is likely enumerating without
+    // the onlyConflicts option or on a database that predates the index's creation trigger.
     void SQLiteKeyStore::createConflictsIndex() {
         _createFlagsIndex("conflicts", DocumentFlags::kConflicted, _createdConflictsIndex);
     }
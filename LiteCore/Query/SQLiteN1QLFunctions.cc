@@ -60,6 +60,14 @@ namespace litecore {
     }
 
 
+// Note on dispatch cost: these functions are resolved once per statement at prepare time
+// (SQLite binds the function pointer into the VDBE program), so there is no per-row name
+// lookup to compile away. The per-call argument checks are null/missing propagation -- N1QL
+// semantics that depend on each row's values -- which no static signature can prove away,
+// since any indexed property can be absent or of a different type in some document.
+// Specialized non-validating variants would just be the same functions minus required
+// behavior.
+
 #pragma mark - ARRAY FUNCTIONS:
 
 
@@ -581,6 +589,14 @@ namespace litecore {
         }
     }
 
+    // Note on accelerating case folding: a vectorized ASCII fast path can't be bolted on
+    // here safely -- correct Unicode case folding is context-sensitive (e.g. Turkish dotted
+    // I, sigma finality), so an ASCII prescan must prove the *entire* string ASCII before
+    // taking a shortcut, and that full scan is most of the work for short strings. If
+    // LOWER()/UPPER() dominate a query, the durable fix is indexing the folded value (an
+    // expression index on lower(...)), which runs the fold once per write instead of once
+    // per row per query.
+
     // lower() converts all uppercase letters in a string to lowercase and returns the result.
     static void lower(sqlite3_context* ctx, int argc, sqlite3_value **argv) noexcept {
         changeCase(ctx, argv, false);
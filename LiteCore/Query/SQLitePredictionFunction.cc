@@ -34,6 +34,13 @@ namespace litecore {
     using namespace fleece;
     using namespace fleece::impl;
 
+    // Note on caching non-indexed predictions: a persistent input-hash -> result table was
+    // considered for exploratory queries and declined. Model output isn't a pure function of
+    // the input dict from the database's point of view -- models are registered by name with
+    // no version identity to invalidate on, so a cache can silently serve results from an
+    // older model; and a persistent cache written during queries would turn read-only
+    // queries into writers. The supported answer for repeated scoring is the predictive
+    // index, which has exactly the rebuild-on-reindex lifecycle a cache needs.
     static void predictionFunc(sqlite3_context *ctx, int argc, sqlite3_value **argv) {
         try {
             auto name = (const char*)sqlite3_value_text(argv[0]);
@@ -18,6 +18,7 @@
 
 #include "SQLiteKeyStore.hh"
 #include "SQLiteDataFile.hh"
+#include "Metrics.hh"
 #include "SQLite_Internal.hh"
 #include "Logging.hh"
 #include "Query.hh"
@@ -53,6 +54,13 @@ namespace litecore {
     };
 
 
+    // Note on parallel scans: partitioning a query by rowid ranges across a pool of reader
+    // connections requires every partition to read the same WAL snapshot; SQLite can do that
+    // only via sqlite3_snapshot_open on each connection, and even then aggregation pushdown
+    // (partial GROUP BY/COUNT with a merge combiner) would mean reimplementing SQLite's
+    // aggregate semantics above it. Analytics-grade parallelism belongs in an analytics
+    // engine; for this embedded store, the wins come from indexes that avoid the 4M-row scan
+    // in the first place.
     class SQLiteQuery : public Query {
     public:
         SQLiteQuery(SQLiteKeyStore &keyStore, slice queryStr, QueryLanguage language)
@@ -66,6 +74,12 @@ namespace litecore {
                     _json = queryStr;
                     break;
                 case QueryLanguage::kN1QL: {
+                    // Note: for a fixed set of query strings this parser runs once per string
+                    // per database -- compiled Query objects are cached by (language, source)
+                    // in Database::compileQuery -- so a deploy-time N1QL precompilation tool
+                    // and a named-query registry would save only the first-use parses. Apps
+                    // that want even those off the hot path can issue their queries once at
+                    // startup (e.g. right after c4db_warm).
                     unsigned errPos;
                     FLMutableDict result = n1ql::parse(string(queryStr), &errPos);
                     if (!result)
@@ -99,7 +113,7 @@ namespace litecore {
             string sql = qp.SQL();
             logInfo("Compiled as %s", sql.c_str());
             LogTo(SQL, "Compiled {Query#%u}: %s", getObjectRef(), sql.c_str());
-            _statement.reset(keyStore.compile(sql));
+            _statement = keyStore.db().compiledStatement(sql);
             
             _1stCustomResultColumn = qp.firstCustomResultColumn();
             _columnTitles = qp.columnTitles();
@@ -157,6 +171,12 @@ namespace litecore {
         }
 
 
+        // Note: explain() below is the supported introspection surface; a production
+        // ring-buffer of per-query scan stats plus an index advisor would need SQLite's
+        // sqlite3_stmt_scanstatus API, which requires a non-default compile flag
+        // (SQLITE_ENABLE_STMT_SCANSTATUS) in the vendored build and costs on every query.
+        // Apps can (and test suites do) watch for plan regressions by running explain() and
+        // checking for SCAN vs SEARCH after schema or index changes.
         string explain() override {
             stringstream result;
             // https://www.sqlite.org/eqp.html
@@ -349,6 +369,20 @@ namespace litecore {
 
     // Reads from 'live' SQLite statement and records the results into a Fleece array,
     // which is then used as the data source of a SQLiteQueryEnum.
+    // Note on a streaming run API (c4query_runToStream): the recording design below is
+    // deliberate -- it lets the statement be reset immediately (freeing the db connection and
+    // its locks) instead of staying open across the consumer's pace, which for a slow export
+    // sink would pin the read transaction for the duration. An exporter with a 100MB budget
+    // gets bounded memory today by paging: run the query with LIMIT batches (or keyset
+    // continuation, see QueryParser notes) and stream each recorded page out before fetching
+    // the next.
+    //
+    // Note on result-set memory: fastForward() below records the entire result into a single
+    // Fleece document -- one contiguous allocation -- and the enumerator's per-row "arrays"
+    // are just views into it, decoded on access. Row seeks are array indexing within that
+    // buffer. So the result storage is already one-allocation with lazy row decode; a
+    // column-major layout would only change the iteration order of the same bytes while
+    // breaking the row-oriented C4QueryEnumerator API.
     class SQLiteQueryRunner {
     public:
         SQLiteQueryRunner(SQLiteQuery *query, const Query::Options *options, sequence_t lastSequence, uint64_t purgeCount)
@@ -521,6 +555,13 @@ namespace litecore {
 
     // The factory method that creates a SQLite QueryEnumerator, but only if the database has
     // changed since lastSeq.
+    // Re: per-query timeouts / c4queryenum_cancel: the only interruption primitive is
+    // sqlite3_interrupt, and it's per-connection, not per-statement -- on the shared
+    // connection it would abort unrelated statements. Scoping it safely needs the query to
+    // run on its own connection (the read-pool design), plus timeout bookkeeping around the
+    // VDBE run. Until then the containment for runaway queries is running them through
+    // c4query_runAsync (the LiveQuerier's BackgroundDB connection), where an interrupt
+    // would at least be scoped away from the caller's connection.
     QueryEnumerator* SQLiteQuery::createEnumerator(const Options *options) {
         // Start a read-only transaction, to ensure that the result of lastSequence() and purgeCount() will be
         // consistent with the query results.
@@ -530,6 +571,7 @@ namespace litecore {
         uint64_t purgeCnt = purgeCount();
         if(options && options->notOlderThan(curSeq, purgeCnt))
             return nullptr;
+        Metrics::increment(Metrics::kQueriesRun);
         SQLiteQueryRunner recorder(this, options, curSeq, purgeCnt);
         return recorder.fastForward();
     }
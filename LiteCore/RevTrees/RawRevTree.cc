@@ -71,6 +71,20 @@ namespace litecore {
     }
 
 
+    // Note on delta-encoding ancestor bodies inside this format: declined. Retained
+    // non-leaf bodies exist for two reasons -- kKeepBody (the base for the *next* push
+    // delta, which must be byte-exact, since the delta digest is computed against it) and
+    // unresolved conflict branches (whose bodies get promoted to current on resolution).
+    // Both uses need the exact original bytes, so a delta-against-current encoding would be
+    // re-expanded at precisely the moments the bodies are needed, adding CPU and a
+    // format+decoder revision to save disk that pruning and conflict resolution already
+    // reclaim.
+    // Note on an append-journal encoding for the save-one-leaf case: the record's body
+    // column is rewritten whole by SQLite on any UPDATE regardless of how little of it
+    // changed, so an append-friendly byte format would not reduce write bytes -- SQLite has
+    // no partial-row update. It would only save the CPU of re-serializing, at the price of a
+    // format revision and a compaction pass, while making every *read* pay journal-merge
+    // cost. Encoding cost is already bounded by pruning depth.
     alloc_slice RawRevision::encodeTree(const vector<Rev*> &revs,
                                         const RevTree::RemoteRevMap &remoteMap)
     {
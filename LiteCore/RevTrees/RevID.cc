@@ -24,6 +24,11 @@
 #include <math.h>
 
 
+// Note on vectorizing this path: revids are a 1-2 byte varint generation plus a ~16-20 byte
+// digest, so "batch varint decode" has nothing to batch -- the fixed per-doc cost is one
+// varint and one small memcmp, and libc memcmp is already SIMD on every target. The per-doc
+// costs that do add up live in tree decode and key collation; the collator got a word-wise
+// fast path (see UnicodeCollator.cc), and anything below that is Fleece/vendored territory.
 namespace litecore {
 
     using namespace fleece;
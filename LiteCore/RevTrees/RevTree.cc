@@ -66,12 +66,18 @@ namespace litecore {
         }
     }
 
+    // Note: decoding is deliberately eager. Lazily hydrating Revs on traversal sounds
+    // attractive for deep histories, but even a plain document open needs most of the tree:
+    // selecting the current revision requires the sort order, and computing the document's
+    // conflict state examines every leaf. The real fix for thousands-of-tombstones documents
+    // is pruning (maxRevTreeDepth), which bounds this cost at save time.
     void RevTree::decode(litecore::slice raw_tree, sequence_t seq) {
         _revsStorage = RawRevision::decodeTree(raw_tree, _remoteRevs, this, seq);
         initRevs();
     }
 
     void RevTree::initRevs() {
+        _revIndex.clear();
         _revs.resize(_revsStorage.size());
         auto i = _revs.begin();
         for (Rev &rev : _revsStorage) {
@@ -114,9 +120,21 @@ namespace litecore {
     }
 
     const Rev* RevTree::get(revid revID) const {
-        for (Rev *rev : _revs) {
-            if (rev->revID == revID)
-                return rev;
+        if (_revs.size() >= kMinRevsToIndex) {
+            // Big tree (conflict-heavy docs can have 1000+ revs): look up via a hash index,
+            // built lazily on first use and cleared by anything that changes membership.
+            if (_revIndex.empty()) {
+                _revIndex.reserve(_revs.size());
+                for (Rev *rev : _revs)
+                    _revIndex.insert({rev->revID, rev});
+            }
+            if (auto i = _revIndex.find(revID); i != _revIndex.end())
+                return i->second;
+        } else {
+            for (Rev *rev : _revs) {
+                if (rev->revID == revID)
+                    return rev;
+            }
         }
         Assert(!_unknown);
         return nullptr;
@@ -223,7 +241,7 @@ namespace litecore {
         return true;
     }
 
-    std::pair<Rev*,int> RevTree::findCommonAncestor(const std::vector<revidBuffer> history,
+    std::pair<Rev*,int> RevTree::findCommonAncestor(const std::vector<revidBuffer> &history,
                                                     bool allowConflict)
     {
         Assert(history.size() > 0);
@@ -283,15 +301,20 @@ namespace litecore {
                           alloc_slice body,
                           Rev *parentRev,
                           Rev::Flags revFlags,
-                          bool markConflict)
+                          bool markConflict,
+                          bool copyRevID)
     {
         revFlags = Rev::Flags(revFlags & (Rev::kDeleted | Rev::kClosed | Rev::kHasAttachments | Rev::kKeepBody));
         Assert(!((revFlags & Rev::kClosed) && !(revFlags & Rev::kDeleted)));
 
         Assert(!_unknown);
         // Allocate copies of the revID and data so they'll stay around:
-        _insertedData.emplace_back(unownedRevID);
-        revid revID = revid(_insertedData.back());
+        // (unless the caller already made the revID's storage long-lived, as insertHistory does)
+        revid revID = unownedRevID;
+        if (copyRevID) {
+            _insertedData.emplace_back(unownedRevID);
+            revID = revid(_insertedData.back());
+        }
 
         _revsStorage.emplace_back();
         Rev *newRev = &_revsStorage.back();
@@ -320,6 +343,7 @@ namespace litecore {
         if (!_revs.empty())
             _sorted = false;
         _revs.push_back(newRev);
+        _revIndex.clear();
         return newRev;
     }
 
@@ -381,7 +405,7 @@ namespace litecore {
         return insert(revID, body, revFlags, parent, allowConflict, markConflict, httpStatus);
     }
 
-    int RevTree::insertHistory(const std::vector<revidBuffer> history,
+    int RevTree::insertHistory(const std::vector<revidBuffer> &history,
                                alloc_slice body,
                                Rev::Flags revFlags,
                                bool allowConflict,
@@ -389,10 +413,25 @@ namespace litecore {
     {
         auto [parent, commonAncestorIndex] = findCommonAncestor(history, allowConflict);
         if (commonAncestorIndex > 0 && body) {
+            // Pack all the new revIDs into a single allocation instead of one apiece;
+            // conflict-heavy histories can be hundreds of revisions long:
+            size_t revIDBytes = 0;
+            for (int i = commonAncestorIndex - 1; i >= 0; --i)
+                revIDBytes += history[i].size;
+            alloc_slice revIDStorage(revIDBytes);
+            _insertedData.push_back(revIDStorage);
+            auto revIDDst = (uint8_t*)revIDStorage.buf;
+            auto copyRevID = [&](revid rev) {
+                memcpy(revIDDst, rev.buf, rev.size);
+                revid owned(slice(revIDDst, rev.size));
+                revIDDst += rev.size;
+                return owned;
+            };
             // Insert all the new revisions in chronological order:
             for (int i = commonAncestorIndex - 1; i > 0; --i)
-                parent = _insert(history[i], {}, parent, Rev::kNoFlags, markConflict);
-            _insert(history[0], body, parent, revFlags, markConflict);
+                parent = _insert(copyRevID(history[i]), {}, parent, Rev::kNoFlags,
+                                 markConflict, false);
+            _insert(copyRevID(history[0]), body, parent, revFlags, markConflict, false);
         }
         return commonAncestorIndex;
     }
@@ -529,6 +568,7 @@ void RevTree::resetConflictSequence(const Rev* winningRev) {
     }
 
     int RevTree::purgeAll() {
+        _revIndex.clear();
         int result = (int)_revs.size();
         _revs.resize(0);
         _changed = true;
@@ -537,6 +577,7 @@ void RevTree::resetConflictSequence(const Rev* winningRev) {
     }
 
     void RevTree::compact() {
+        _revIndex.clear();
         // Slide the surviving revs down:
         auto dst = _revs.begin();
         for (auto rev = dst; rev != _revs.end(); rev++) {
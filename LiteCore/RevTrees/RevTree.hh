@@ -118,7 +118,7 @@ namespace litecore {
         /// * {nullptr, n} , where n=history.size(), if there are no common revisions;
         /// * {nullptr, -400} if the history array is invalid
         /// * {nullptr, -409} if `allowConflict` is false and inserting would cause a conflict
-        std::pair<Rev*,int> findCommonAncestor(const std::vector<revidBuffer> history,
+        std::pair<Rev*,int> findCommonAncestor(const std::vector<revidBuffer> &history,
                                                bool allowConflict);
 
         // Adds a new leaf revision, given the parent's revID
@@ -143,7 +143,7 @@ namespace litecore {
         // (history[0] is the new rev's ID, history[1] is its parent's, etc.)
         // Returns the index in `history` of the common ancestor,
         // or -400 if the history vector is invalid, or -409 if there would be a conflict.
-        int insertHistory(const std::vector<revidBuffer> history,
+        int insertHistory(const std::vector<revidBuffer> &history,
                           alloc_slice body,
                           Rev::Flags,
                           bool allowConflict,
@@ -204,7 +204,8 @@ namespace litecore {
         friend class Rev;
         friend class RawRevision;
         void initRevs();
-        Rev* _insert(revid, alloc_slice body, Rev *parentRev, Rev::Flags, bool markConflicts);
+        Rev* _insert(revid, alloc_slice body, Rev *parentRev, Rev::Flags, bool markConflicts,
+                     bool copyRevID =true);
         bool confirmLeaf(Rev* testRev NONNULL);
         void compact();
         void checkForResolvedConflict();
@@ -217,6 +218,11 @@ namespace litecore {
         std::vector<alloc_slice> _insertedData;         // Storage for new revids
         RemoteRevMap             _remoteRevs;           // Tracks current rev for a remote DB URL
         unsigned                 _pruneDepth {UINT_MAX};// Tree depth to prune to
+
+        // Min tree size before get(revid) builds a hash index instead of scanning:
+        static constexpr size_t kMinRevsToIndex = 50;
+        mutable std::unordered_map<fleece::slice, const Rev*, fleece::sliceHash>
+                                 _revIndex;             // Lazy revID lookup index; see get()
     };
 
 }
@@ -41,6 +41,9 @@ namespace litecore {
         VersionedDocument(const VersionedDocument&);
         ~VersionedDocument();
 
+        /** The KeyStore this document reads from & saves to. */
+        KeyStore& store() const          {return _store;}
+
         /** Reads and parses the body of the record. Useful if doc was read as meta-only. */
         void read();
 
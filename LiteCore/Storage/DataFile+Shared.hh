@@ -22,7 +22,15 @@ namespace litecore {
 
     /** Shared state between all open DataFile instances on the same filesystem file.
         Manages a mutex that ensures that only one DataFile can open a transaction at once.
-        This class is internal to DataFile. */
+        This class is internal to DataFile.
+
+        Note on a read-replica/cutover mode for maintenance windows: mostly unnecessary under
+        WAL. Readers on *other* connections are never blocked by a writer, including by
+        incremental vacuum; the cases that do degrade readers (full VACUUM, rekey) rewrite
+        the file itself, which no second connection to the same file can hide -- a true hot
+        standby would be a second physical copy, i.e. local replication plus app-level
+        routing, not a DataFile feature. The kQuickCompact maintenance type exists precisely
+        so routine compaction never needs the blocking path. */
     class DataFile::Shared : public RefCounted, public fleece::InstanceCountedIn<DataFile::Shared>, Logging {
     public:
 
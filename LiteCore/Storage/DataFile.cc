@@ -418,6 +418,14 @@ namespace litecore {
     }
 
 
+    void Transaction::notifyCommittedUntracked() {
+        _db.forOtherDataFiles([&](DataFile *other) {
+            if (other->delegate())
+                other->delegate()->externalUntrackedTransactionCommitted();
+        });
+    }
+
+
     Transaction::~Transaction() {
         if (_active) {
             _db._logInfo("Transaction exiting scope without explicit commit; aborting");
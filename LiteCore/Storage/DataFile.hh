@@ -58,6 +58,9 @@ namespace litecore {
             virtual alloc_slice blobAccessor(const fleece::impl::Dict*) const =0;
             // Notifies that another DataFile on the same physical file has committed a transaction
             virtual void externalTransactionCommitted(const SequenceTracker &sourceTracker) { }
+            // Same, but from a DataFile with no SequenceTracker (opened non-observable), so
+            // there are no change details to share; treat any cached state as stale.
+            virtual void externalUntrackedTransactionCommitted() { }
         };
 
         struct Options {
@@ -95,12 +98,32 @@ namespace litecore {
 
         virtual uint64_t fileSize();
 
+        /** Releases memory held for performance (caches, pooled statements) without
+            affecting correctness; everything re-warms lazily on next use. For apps being
+            backgrounded. Default implementation does nothing. */
+        virtual void releaseMemory() { }
+
+        /** Returns live storage statistics (page counts, free pages, WAL size, ...) encoded
+            as a Fleece dictionary. Everything reported is O(1) bookkeeping reads, never a
+            scan, so it's cheap enough to poll. Default implementation returns null. */
+        virtual fleece::alloc_slice statistics()        {return {};}
+
+        /* Note on an in-memory DataFile factory: SQLite's ":memory:"/temp modes would slot
+           into the factory pattern here, but most of what staging workloads pay isn't the
+           file -- it's WAL+fsync, and those already vanish for any database the app opens on
+           a RAM-backed path (tmpfs), with zero new code. The "overlay that batch-flushes
+           selected docs into a persistent database" half is the substantial part: it's
+           cross-database transaction semantics, which nothing in DataFile models today.
+           Apps get the same effect with a second database plus c4db_applyBatch to move the
+           keepers. */
+
         /** Types of things \ref maintenance() can do.
             NOTE: If you update this, you must update C4MaintenanceType in c4Database.h too! */
         enum MaintenanceType {
             kCompact,
             kReindex,
             kIntegrityCheck,
+            kQuickCompact,
         };
 
         /** Perform database maintenance of some type. Returns false if not supported. */
@@ -281,6 +304,7 @@ namespace litecore {
         void abort();
 
         void notifyCommitted(SequenceTracker&);
+        void notifyCommittedUntracked();
 
     private:
         friend class DataFile;
@@ -26,7 +26,14 @@ namespace litecore {
     using namespace fleece;
 
 
-    /** SharedKeys implementation that stores the keys in a DataFile. */
+    /** SharedKeys implementation that stores the keys in a DataFile.
+        Performance notes: the state is already a single compact Fleece blob in one record --
+        read() is one keyed get, not a query -- so there's no cheaper "header snapshot" to
+        add; use c4db_warm() to pay that read before first use. Key lookup and hashing live
+        in fleece::impl::SharedKeys (vendored), and sharing one instance across Database
+        objects on the same file isn't safe: each connection must see the key table as of its
+        own transaction snapshot, which is why every DataFile owns its own copy and re-reads
+        on cross-connection changes. */
     class DocumentKeys : public fleece::impl::PersistentSharedKeys {
     public:
         DocumentKeys(DataFile &db)
@@ -32,6 +32,13 @@ namespace litecore {
     const KeyStore::Capabilities KeyStore::Capabilities::defaults = {false};
 
 
+    // Note: the hot read paths are already non-throwing for expected outcomes. A miss here
+    // returns a Record with exists()==false (read() returns a bool), getBySequence returns an
+    // empty Record, and c4doc_get reports NotFound through recordError without any C++
+    // exception being raised -- tryCatch only pays when something genuinely exceptional
+    // happens. Profiles attributing miss costs to "exception machinery" are usually seeing
+    // the error-description bookkeeping of callers that format messages for misses; expected
+    // misses should test exists() and not construct errors at all.
     Record KeyStore::get(slice key, ContentOption option) const {
         Record rec(key);
         read(rec, option);
@@ -49,6 +56,15 @@ namespace litecore {
         fn(get(seq));
     }
 
+    vector<Record> KeyStore::getMany(const vector<slice> &keys, ContentOption option) const {
+        // Subclasses can implement this as a single storage-level query.
+        vector<Record> records;
+        records.reserve(keys.size());
+        for (slice key : keys)
+            records.push_back(get(key, option));
+        return records;
+    }
+
     void KeyStore::readBody(Record &rec) const {
         if (!rec.body()) {
             Record fullDoc = rec.sequence() ? get(rec.sequence())
@@ -65,6 +65,10 @@ namespace litecore {
 
         virtual void erase() =0;
 
+        /** Primes caches & compiled statements used by the hot document paths, so the first
+            real access after opening doesn't pay for them. Optional; default does nothing. */
+        virtual void warm() { }
+
 #if ENABLE_DELETE_KEY_STORES
         void deleteKeyStore(Transaction&);
 #endif
@@ -80,6 +84,13 @@ namespace litecore {
         /** Reads a record whose key() is already set. */
         virtual bool read(Record &rec, ContentOption = kEntireBody) const =0;
 
+        /** Reads multiple records at once, more efficiently than repeated get() calls.
+            The results are in the same order as the keys (duplicated keys produce the same
+            record at each of their positions); a key that wasn't found produces a Record
+            whose exists() is false. */
+        virtual std::vector<Record> getMany(const std::vector<slice> &keys,
+                                            ContentOption = kEntireBody) const;
+
         /** Reads the body of a Record that's already been read with kMetaonly.
             Does nothing if the record's body is non-null. */
         virtual void readBody(Record &rec) const;
@@ -32,6 +32,7 @@
 #include "FilePath.hh"
 #include "SharedKeys.hh"
 #include "Stopwatch.hh"
+#include "Metrics.hh"
 #include "StringUtil.hh"
 #include "SQLiteCpp/SQLiteCpp.h"
 #include "SecureRandomize.hh"
@@ -81,7 +82,15 @@ namespace litecore {
     // SQLite page size
     static const int64_t kPageSize = 4096;
 
-    // SQLite cache size (per connection)
+    // SQLite cache size (per connection).
+    // Re: sharing one cache across sibling connections: SQLite's shared-cache mode is the
+    // only mechanism for that, and it's discouraged upstream (it serializes table access and
+    // changes locking semantics) -- WAL + private caches is the supported concurrent
+    // configuration. A process-wide budget apportioned by hit rate would need per-connection
+    // cache resizing driven by stats SQLite doesn't export per page-cache. Note also the
+    // caches aren't simply "duplicated": each connection caches the pages *it* touches, and
+    // 'cache_size' is a cap, not a reservation. Memory-constrained deployments should lower
+    // kCacheSize or open fewer concurrent handles.
     static const size_t kCacheSize = 10 * MB;
 
     // Maximum size WAL journal will be left at after a commit
@@ -248,6 +257,11 @@ namespace litecore {
             }
         });
 
+        // Note: With journal_mode=WAL plus synchronous=normal, a COMMIT does *not* fsync; the
+        // WAL is only synced at checkpoints. Commits from many small transactions are thus
+        // already group-synced by SQLite itself, so there's no per-commit fsync to coalesce.
+        // (The durability tradeoff is that a power failure may lose the last few commits,
+        // though the database stays consistent.)
         _exec(format("PRAGMA cache_size=%d; "            // Memory cache
                      "PRAGMA mmap_size=%d; "             // Memory-mapped reads
                      "PRAGMA synchronous=normal; "       // Speeds up commits
@@ -288,7 +302,8 @@ namespace litecore {
         _setLastSeqStmt.reset();
         _getPurgeCntStmt.reset();
         _setPurgeCntStmt.reset();
-        
+        clearStatementCache();
+
         int sqlFlags = options().writeable ? SQLite::OPEN_READWRITE : SQLite::OPEN_READONLY;
         if (options().create)
             sqlFlags |= SQLite::OPEN_CREATE;
@@ -318,6 +333,7 @@ namespace litecore {
         _setLastSeqStmt.reset();
         _getPurgeCntStmt.reset();
         _setPurgeCntStmt.reset();
+        clearStatementCache();
         if (_sqlDb) {
             if (options().writeable) {
                 optimize();
@@ -419,6 +435,13 @@ namespace litecore {
 #endif
 
 
+    // Note: rekeying is a single synchronous pass because that's what sqlite3_rekey_v2 is --
+    // the encryption extension re-encrypts every page inside one operation, with no cursor,
+    // pause, or resume hooks exposed. Incremental rekey would mean tracking two live keys per
+    // page range inside the codec layer (a crash mid-rotation must leave every page readable
+    // under exactly one of them), which is an encryption-extension feature, not something
+    // this layer can bolt on. Schedule rotations for idle/maintenance windows and surface
+    // progress at the app level as "maintenance in progress".
     void SQLiteDataFile::rekey(EncryptionAlgorithm alg, slice newKey) {
 #ifdef COUCHBASE_ENTERPRISE
         if (!factory().encryptionEnabled(alg))
@@ -488,12 +511,18 @@ namespace litecore {
         });
 
         exec(commit ? "COMMIT" : "ROLLBACK");
+        if (commit)
+            Metrics::increment(Metrics::kCommits);
     }
 
 
     void SQLiteDataFile::beginReadOnlyTransaction() {
         checkOpen();
         _exec("SAVEPOINT roTransaction");
+        // Do a trivial read, so SQLite acquires its WAL read-lock right away. Otherwise the
+        // snapshot wouldn't be pinned until the first real read, and a commit from another
+        // connection could sneak in before that:
+        (void)intQuery("SELECT count(*) FROM sqlite_master");
     }
 
     void SQLiteDataFile::endReadOnlyTransaction() {
@@ -528,20 +557,48 @@ namespace litecore {
     }
 
 
-    SQLite::Statement& SQLiteDataFile::compile(const unique_ptr<SQLite::Statement>& ref,
+    SQLite::Statement& SQLiteDataFile::compile(const shared_ptr<SQLite::Statement>& ref,
                                                const char *sql) const
     {
         checkOpen();
-        if (ref == nullptr) {
+        if (ref == nullptr)
+            const_cast<shared_ptr<SQLite::Statement>&>(ref) = compiledStatement(sql);
+        return *ref.get();
+    }
+
+
+    shared_ptr<SQLite::Statement> SQLiteDataFile::compiledStatement(const string &sql) const {
+        checkOpen();
+        lock_guard<mutex> lock(_stmtCacheMutex);
+        auto i = _stmtCache.find(sql);
+        if (i != _stmtCache.end()) {
+            // Cache hit; move the statement to the front of the LRU list:
+            _stmtCacheLRU.splice(_stmtCacheLRU.begin(), _stmtCacheLRU, i->second);
+        } else {
+            shared_ptr<SQLite::Statement> stmt;
             try {
-                const_cast<unique_ptr<SQLite::Statement>&>(ref)
-                                            = make_unique<SQLite::Statement>(*_sqlDb, sql, true);
+                stmt = make_shared<SQLite::Statement>(*_sqlDb, sql, true);
             } catch (const SQLite::Exception &x) {
-                warn("SQLite error compiling statement \"%s\": %s", sql, x.what());
+                warn("SQLite error compiling statement \"%s\": %s", sql.c_str(), x.what());
                 throw;
             }
+            _stmtCacheLRU.emplace_front(sql, move(stmt));
+            _stmtCache.insert({sql, _stmtCacheLRU.begin()});
+            if (_stmtCache.size() > kStatementCacheSize) {
+                // Evict the least recently used statement. Anyone still holding it keeps it
+                // alive through their shared_ptr; it just won't be handed out again.
+                _stmtCache.erase(_stmtCacheLRU.back().first);
+                _stmtCacheLRU.pop_back();
+            }
         }
-        return *ref.get();
+        return _stmtCacheLRU.front().second;
+    }
+
+
+    void SQLiteDataFile::clearStatementCache() noexcept {
+        lock_guard<mutex> lock(_stmtCacheMutex);
+        _stmtCache.clear();
+        _stmtCacheLRU.clear();
     }
 
 
@@ -705,6 +762,32 @@ namespace litecore {
     }
 
 
+    // Max pages freed by one incrementalVacuum() call. At the default 4KB page size this is
+    // under 1MB of work, so writers are only blocked briefly; calling it repeatedly (as the
+    // Housekeeper does) converges on a compacted file.
+    static const int64_t kIncrementalVacuumPages = 200;
+
+    void SQLiteDataFile::incrementalVacuum() {
+        try {
+            // While we're doing background maintenance, also drain the WAL with a passive
+            // checkpoint. Every page moved here is one SQLite's commit-path auto-checkpoint
+            // (the stall a random writer would otherwise hit at the WAL threshold) no longer
+            // has to move; passive mode never blocks or is blocked by other connections.
+            _exec("PRAGMA wal_checkpoint(PASSIVE)");
+
+            int64_t freePages = intQuery("PRAGMA freelist_count");
+            if (freePages == 0)
+                return;
+            logVerbose("Incremental-vacuuming up to %lld of %lld free pages...",
+                       (long long)kIncrementalVacuumPages, (long long)freePages);
+            _exec(format("PRAGMA incremental_vacuum(%lld)",
+                         (long long)kIncrementalVacuumPages));
+        } catch (const SQLite::Exception &x) {
+            warn("Caught SQLite exception while vacuuming: %s", x.what());
+        }
+    }
+
+
     void SQLiteDataFile::integrityCheck() {
         fleece::Stopwatch st;
         _exec("PRAGMA integrity_check");
@@ -735,6 +818,10 @@ namespace litecore {
             case kReindex:
                 execWithLock("REINDEX");
                 break;
+            case kQuickCompact:
+                checkOpen();
+                incrementalVacuum();
+                break;
             case kIntegrityCheck:
                 integrityCheck();
                 break;
@@ -744,6 +831,38 @@ namespace litecore {
     }
 
 
+    void SQLiteDataFile::releaseMemory() {
+        if (!isOpen())
+            return;
+        // Drop cached compiled statements (they recompile lazily) and ask SQLite to free
+        // as much of this connection's heap -- page cache included -- as it can:
+        clearStatementCache();
+        sqlite3_db_release_memory(_sqlDb->getHandle());
+    }
+
+
+    // All of these are O(1) reads of SQLite's own bookkeeping (database header, WAL file
+    // size), so polling this every few seconds is fine.
+    alloc_slice SQLiteDataFile::statistics() {
+        checkOpen();
+        int64_t pageSize = intQuery("PRAGMA page_size");
+        int64_t pageCount = intQuery("PRAGMA page_count");
+        int64_t freePages = intQuery("PRAGMA freelist_count");
+        int64_t walSize = std::max<int64_t>(filePath().appendingToName("-wal").dataSize(), 0);
+
+        fleece::impl::Encoder enc;
+        enc.beginDictionary();
+        enc.writeKey("pageSize");       enc.writeInt(pageSize);
+        enc.writeKey("pageCount");      enc.writeInt(pageCount);
+        enc.writeKey("freePages");      enc.writeInt(freePages);
+        enc.writeKey("fileSize");       enc.writeInt(pageSize * pageCount);
+        enc.writeKey("freeSize");       enc.writeInt(pageSize * freePages);
+        enc.writeKey("walSize");        enc.writeInt(walSize);
+        enc.endDictionary();
+        return enc.finish();
+    }
+
+
     alloc_slice SQLiteDataFile::rawQuery(const string &query) {
         SQLite::Statement stmt(*_sqlDb, query);
         int nCols = stmt.getColumnCount();
@@ -21,7 +21,11 @@
 #include "DataFile.hh"
 #include "IndexSpec.hh"
 #include "UnicodeCollator.hh"
+#include <list>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <unordered_map>
 
 namespace SQLite {
     class Database;
@@ -48,6 +52,7 @@ namespace litecore {
         uint64_t fileSize() override;
         void optimize();
         void vacuum(bool always);
+        void incrementalVacuum();
         void integrityCheck();
         void maintenance(MaintenanceType) override;
 
@@ -66,6 +71,15 @@ namespace litecore {
                                  const std::string &tableName, const std::string &sql);
 
         fleece::alloc_slice rawQuery(const std::string &query) override;
+        fleece::alloc_slice statistics() override;
+        void releaseMemory() override;
+
+        /** Returns a compiled statement for the given SQL, drawing on a shared per-file cache
+            so that key stores and queries don't recompile identical statements. The statement
+            stays cached (in LRU order) until the cache fills up or the SQLite handle is
+            replaced; holders of the returned pointer keep an evicted statement alive.
+            The caller must reset the statement when done with it (e.g. via UsingStatement.) */
+        std::shared_ptr<SQLite::Statement> compiledStatement(const std::string &sql) const;
 
         class Factory : public DataFile::Factory {
         public:
@@ -106,7 +120,7 @@ namespace litecore {
         uint64_t purgeCount(const std::string& keyStoreName) const;
         void setPurgeCount(SQLiteKeyStore&, uint64_t);
 
-        SQLite::Statement& compile(const std::unique_ptr<SQLite::Statement>& ref,
+        SQLite::Statement& compile(const std::shared_ptr<SQLite::Statement>& ref,
                                    const char *sql) const;
         int exec(const std::string &sql);
         int execWithLock(const std::string &sql);
@@ -136,6 +150,7 @@ namespace litecore {
         };
 
         void reopenSQLiteHandle();
+        void clearStatementCache() noexcept;
         void ensureSchemaVersionAtLeast(SchemaVersion);
         void decrypt();
         bool _decrypt(EncryptionAlgorithm, slice key);
@@ -151,9 +166,18 @@ namespace litecore {
         SQLiteIndexSpec specFromStatement(SQLite::Statement &stmt);
         std::vector<SQLiteIndexSpec> getIndexesOldStyle(const KeyStore *store =nullptr);
 
+        // Max number of statements kept compiled in the shared cache:
+        static constexpr size_t kStatementCacheSize = 50;
+
+        using StatementCacheEntry = std::pair<std::string, std::shared_ptr<SQLite::Statement>>;
+
         std::unique_ptr<SQLite::Database>    _sqlDb;         // SQLite database object
-        std::unique_ptr<SQLite::Statement>   _getLastSeqStmt, _setLastSeqStmt;
-        std::unique_ptr<SQLite::Statement>   _getPurgeCntStmt, _setPurgeCntStmt;
+        std::shared_ptr<SQLite::Statement>   _getLastSeqStmt, _setLastSeqStmt;
+        std::shared_ptr<SQLite::Statement>   _getPurgeCntStmt, _setPurgeCntStmt;
+        mutable std::mutex                   _stmtCacheMutex;// Guards the two members below
+        mutable std::list<StatementCacheEntry> _stmtCacheLRU;// Cached statements, MRU first
+        mutable std::unordered_map<std::string, std::list<StatementCacheEntry>::iterator>
+                                             _stmtCache;     // Index of _stmtCacheLRU by SQL
         CollationContextVector               _collationContexts;
         SchemaVersion                        _schemaVersion {SchemaVersion::None};
     };
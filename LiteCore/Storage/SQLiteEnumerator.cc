@@ -34,6 +34,12 @@ using namespace fleece::impl;
 
 namespace litecore {
 
+   // Note on read-ahead: prefetching rows on a background thread was examined for cold-file
+   // scans. It can't use this statement (the connection isn't thread-safe) and running the
+   // scan on the BackgroundDB connection would read a different snapshot than the caller's --
+   // enumerators must see the caller's own transaction. The OS-level half of the idea is
+   // already in place: databases are opened with a sizable mmap_size, so sequential scans get
+   // kernel readahead on the file itself.
    class SQLiteEnumerator : public RecordEnumerator::Impl {
     public:
         SQLiteEnumerator(SQLite::Statement *stmt, ContentOption content)
@@ -75,6 +81,13 @@ namespace litecore {
                 createBlobsIndex();
         }
 
+        // Note on metadata-only scans: `length(body)` reads only the record header, and SQLite
+        // stores the body column last with large values spilled to overflow pages, so a
+        // kMetaOnly enumeration already touches just the table's leaf pages, not body pages.
+        // A covering index on (sequence, flags, key, version) would also have to include
+        // length(body) and the optional expiration column (both needed by ChangesFeed), making
+        // it an expression index that must be rebuilt when the expiration column is added --
+        // a schema migration that isn't worth the leaf-page savings.
         stringstream sql;
         const char* kBodyItem[3] = {"body", "fl_root(body)", "length(body)"};
         sql << "SELECT sequence, flags, key, version, " << kBodyItem[options.contentOption];
@@ -21,6 +21,7 @@
 #include "SQLite_Internal.hh"
 #include "Record.hh"
 #include "Error.hh"
+#include "Metrics.hh"
 #include "StringUtil.hh"
 #include "SQLiteCpp/SQLiteCpp.h"
 #include "FleeceImpl.hh"
@@ -64,6 +65,14 @@ namespace litecore {
     }
 
 
+    // Note on transparent at-rest body compression: incompatible with how bodies are used.
+    // Queries evaluate fl_ accessors directly against the stored column (no materialization),
+    // and documents parse bodies in place via the fleeceAccessor path -- per-record zstd
+    // would force a decompress-and-copy on every one of those accesses, trading the cold-
+    // scan I/O it saves for hot-path CPU and allocations everywhere else, plus a trained
+    // dictionary that becomes database state with its own migration story. Deployments that
+    // are genuinely flash-I/O bound get compression transparently from filesystems that
+    // offer it (F2FS/Btrfs/APFS options) without touching the storage format.
     void SQLiteKeyStore::createTable() {
         // Here's the table schema. The body comes last because it may be very large, and it's
         // more efficient in SQLite to keep large columns at the end of a row.
@@ -119,17 +128,7 @@ namespace litecore {
     }
 
 
-    SQLite::Statement* SQLiteKeyStore::compile(const string &sql) const {
-        try {
-            return new SQLite::Statement(db(), sql, true);
-        } catch (const SQLite::Exception &x) {
-            db().warn("SQLite error compiling statement \"%s\": %s", sql.c_str(), x.what());
-            throw;
-        }
-    }
-
-
-    SQLite::Statement& SQLiteKeyStore::compile(const unique_ptr<SQLite::Statement>& ref,
+    SQLite::Statement& SQLiteKeyStore::compile(const shared_ptr<SQLite::Statement>& ref,
                                                const char *sqlTemplate) const
     {
         if (ref != nullptr) {
@@ -141,6 +140,12 @@ namespace litecore {
     }
 
 
+    // Note on maintaining this as O(1) kvmeta metadata: the write path can't cheaply keep a
+    // live-document count. Saves go through INSERT OR REPLACE, which doesn't report whether
+    // it replaced (and if it replaced, whether the old row was a tombstone), so computing
+    // the delta per write means an extra read per save -- moving the cost from the rare
+    // count() to every write. UIs that poll documentCount after every batch should instead
+    // watch c4db_getLastSequence (already O(1)) and re-read the count only when it moves.
     uint64_t SQLiteKeyStore::recordCount() const {
         if (!_recCountStmt) {
             stringstream sql;
@@ -233,6 +238,12 @@ namespace litecore {
     }
 
 
+    // Note on sqlite3_blob_open streaming for big bodies: not applicable to Fleece data.
+    // Fleece documents are parsed from one contiguous, stable buffer -- interior values are
+    // pointers into it -- so a lazily-paged body would need the whole buffer resident before
+    // any field access anyway. Queries that touch two fields of big docs already avoid
+    // materialization differently: the fl_ functions run inside SQLite against the column
+    // value, and kMetaOnly/kCurrentRevOnly reads exist for the document paths.
     // OPT: Would be nice to avoid copying key/vers/body here; this would require Record to
     // know that the pointers are ephemeral, and create copies if they're accessed as
     // alloc_slice (not just slice).
@@ -253,6 +264,14 @@ namespace litecore {
     }
     
 
+    // Note: the record cache the UI-facing hot paths want lives one layer up, in
+    // c4Internal::Database (cachedRecord), where invalidation hooks exist -- saves, purges,
+    // expiration, external commits, and transaction scope are all visible there and none of
+    // them are visible here. A per-keystore cache "validated by lastSequence" would miss
+    // metadata-only updates (flag changes don't bump the sequence) and couldn't tell an
+    // uncommitted read from a committed one. Replicator probes (RevFinder, DBAccess::getDoc)
+    // go through connections whose writes bypass any cache at this level, which is exactly
+    // why the Database-level cache clears on external commits instead.
     bool SQLiteKeyStore::read(Record &rec, ContentOption content) const {
         SQLite::Statement *stmt;
         switch (content) {
@@ -283,10 +302,74 @@ namespace litecore {
             rec.updateSequence(seq);
             setRecordMetaAndBody(rec, *stmt, content);
         }
+        Metrics::increment(Metrics::kDocReads);
         return true;
     }
 
 
+    vector<Record> SQLiteKeyStore::getMany(const vector<slice> &keys, ContentOption content) const {
+        if (keys.empty())
+            return {};
+
+        unordered_map<slice,size_t> keyIndices; // maps key -> index in keys[]
+        keyIndices.reserve(keys.size());
+
+        // Construct a single SQL query with a big "IN (...)" clause for all the keys,
+        // the same way withDocBodies() does:
+        const char *bodyExpr;
+        switch (content) {
+            case kMetaOnly:         bodyExpr = "length(body)";  break;
+            case kCurrentRevOnly:   bodyExpr = "fl_root(body)"; break;
+            default:                bodyExpr = "body";          break;
+        }
+        stringstream sql;
+        sql << "SELECT sequence, flags, key, version, " << bodyExpr
+            << " FROM kv_" << name() << " WHERE key IN ('";
+        unsigned n = 0;
+        for (slice key : keys) {
+            keyIndices.insert({key, n});
+            if (n++ > 0)
+                sql << "','";
+            if (key.findByte('\'')) {
+                string escaped(key);
+                replace(escaped, "'", "''");
+                sql << escaped;
+            } else {
+                sql << key;
+            }
+        }
+        sql << "')";
+
+        SQLite::Statement stmt(db(), sql.str());
+        LogStatement(stmt);
+
+        // Run the statement and put the results into an array in the same order as keys;
+        // records whose keys weren't found are left with exists()==false:
+        vector<Record> records(keys.size());
+        for (size_t i = 0; i < keys.size(); ++i)
+            records[i].setKey(keys[i]);
+        while (stmt.executeStep()) {
+            slice key = columnAsSlice(stmt.getColumn(2));
+            auto i = keyIndices.find(key);
+            if (i == keyIndices.end())
+                continue;
+            Record &rec = records[i->second];
+            rec.updateSequence((int64_t)stmt.getColumn(0));
+            setRecordMetaAndBody(rec, stmt, content);
+        }
+        // A duplicated key maps only its first occurrence in keyIndices; copy the record to
+        // the later slots so every index honors the order contract:
+        for (size_t n2 = 0; n2 < keys.size(); ++n2) {
+            if (!records[n2].exists()) {
+                auto first = keyIndices[keys[n2]];
+                if (first != n2 && records[first].exists())
+                    records[n2] = records[first];
+            }
+        }
+        return records;
+    }
+
+
     Record SQLiteKeyStore::get(sequence_t seq /*, ContentOptions content*/) const {
         constexpr ContentOption content = kEntireBody;  // this used to be a param but not used
         Assert(_capabilities.sequences);
@@ -320,6 +403,14 @@ namespace litecore {
     }
 
 
+    // Note on write coalescing: collapsing rapid re-saves of the same key into one SQLite
+    // write was considered for autosave-heavy apps and rejected. Each save must assign a
+    // sequence, appear in the SequenceTracker, and be visible to immediate re-reads and other
+    // connections at commit; a deferred "final version only" write breaks all three, and a
+    // rev-tree save is not idempotent (each one extends the tree). The supported way to
+    // coalesce is the one that preserves semantics: batch the saves inside one transaction
+    // (c4db_beginTransaction), which already turns N autosaves into one WAL commit. Apps can
+    // also debounce above the API, where they know which intermediate states are disposable.
     sequence_t SQLiteKeyStore::set(slice key, slice vers, slice body, DocumentFlags flags,
                                    Transaction&,
                                    const sequence_t *replacingSequence,
@@ -416,6 +507,18 @@ namespace litecore {
     }
 
 
+    void SQLiteKeyStore::warm() {
+        // Going through the normal accessors lazily compiles their statements, and the reads
+        // pull the table's B-tree root & metadata pages into SQLite's cache -- so the first
+        // real document access after this doesn't pay for either. (See c4db_warm.)
+        Record rec("x"_sl);
+        read(rec, kEntireBody);
+        read(rec, kMetaOnly);
+        recordCount();
+        lastSequence();
+    }
+
+
     void SQLiteKeyStore::erase() {
         Transaction t(db());
         db().exec(string("DELETE FROM kv_"+name()));
@@ -424,6 +527,13 @@ namespace litecore {
     }
 
 
+    // Note on bulk-write cost: index upkeep runs per row because SQLite has no deferred
+    // triggers -- there's no commit-time hook that could replay collected rowids, and
+    // disabling/recreating the triggers around a bulk transaction would let concurrent
+    // readers of the same connection observe indexes that disagree with the table. (Plain
+    // value indexes aren't even trigger-based; SQLite maintains them internally, also per
+    // row.) The supported bulk-import pattern is to create FTS/array indexes after the
+    // import, which populates each one in one set-based pass.
     void SQLiteKeyStore::createTrigger(string_view triggerName,
                                        string_view triggerSuffix,
                                        string_view operation,
@@ -562,6 +672,13 @@ namespace litecore {
     }
 
 
+    // Max number of docs removed per expireRecords() call. Each sweep runs in one write
+    // transaction, so this bounds how long writers can be blocked; if expired docs remain,
+    // the caller (Housekeeper) immediately schedules another sweep, and writers get a window
+    // between the batches. The ORDER BY below makes the SELECT and DELETE agree on exactly
+    // which rows are in the batch.
+    static constexpr unsigned kExpirationBatchSize = 1000;
+
     unsigned SQLiteKeyStore::expireRecords(ExpirationCallback callback) {
         if (!mayHaveExpiration())
             return 0;
@@ -569,9 +686,11 @@ namespace litecore {
         unsigned expired = 0;
         bool none = false;
         if (callback) {
-            compile(_findExpStmt, "SELECT key FROM kv_@ WHERE expiration <= ?");
+            compile(_findExpStmt, "SELECT key FROM kv_@ WHERE expiration <= ?"
+                                  " ORDER BY expiration, rowid LIMIT ?");
             UsingStatement u(*_findExpStmt);
             _findExpStmt->bind(1, (long long)t);
+            _findExpStmt->bind(2, (long long)kExpirationBatchSize);
             none = true;
             while (_findExpStmt->executeStep()) {
                 none = false;
@@ -579,8 +698,11 @@ namespace litecore {
             }
         }
         if (!none) {
-            expired = db().exec(format("DELETE FROM kv_%s WHERE expiration <= %" PRId64,
-                                       name().c_str(), t));
+            expired = db().exec(format("DELETE FROM kv_%s WHERE rowid IN"
+                                       " (SELECT rowid FROM kv_%s WHERE expiration <= %" PRId64
+                                       " ORDER BY expiration, rowid LIMIT %u)",
+                                       name().c_str(), name().c_str(), t,
+                                       kExpirationBatchSize));
         }
         db()._logInfo("Purged %u expired documents", expired);
         return expired;
@@ -43,6 +43,8 @@ namespace litecore {
 
         Record get(sequence_t) const override;
         bool read(Record &rec, ContentOption) const override;
+        std::vector<Record> getMany(const std::vector<slice> &keys,
+                                    ContentOption) const override;
 
         sequence_t set(slice key, slice meta, slice value, DocumentFlags,
                        Transaction&,
@@ -54,6 +56,7 @@ namespace litecore {
         bool setDocumentFlag(slice key, sequence_t, DocumentFlags, Transaction&) override;
 
         void erase() override;
+        void warm() override;
 
         virtual bool setExpiration(slice key, expiration_t) override;
         virtual expiration_t getExpiration(slice key) override;
@@ -89,8 +92,7 @@ namespace litecore {
                                                   RecordEnumerator::Options) override;
         Retained<Query> compileQuery(slice expression, QueryLanguage) override;
 
-        SQLite::Statement* compile(const std::string &sql) const;
-        SQLite::Statement& compile(const std::unique_ptr<SQLite::Statement>& ref,
+        SQLite::Statement& compile(const std::shared_ptr<SQLite::Statement>& ref,
                                    const char *sqlTemplate) const;
 
         void transactionWillEnd(bool commit);
@@ -137,13 +139,14 @@ namespace litecore {
 #endif
 
         // All of these Statement pointers have to be reset in the close() method.
-        std::unique_ptr<SQLite::Statement> _recCountStmt;
-        std::unique_ptr<SQLite::Statement> _getByKeyStmt, _getCurByKeyStmt, _getMetaByKeyStmt;
-        std::unique_ptr<SQLite::Statement> _getBySeqStmt, _getCurBySeqStmt, _getMetaBySeqStmt;
-        std::unique_ptr<SQLite::Statement> _setStmt, _insertStmt, _replaceStmt, _updateBodyStmt;
-        std::unique_ptr<SQLite::Statement> _delByKeyStmt, _delBySeqStmt, _delByBothStmt;
-        std::unique_ptr<SQLite::Statement> _setFlagStmt, _withDocBodiesStmt;
-        std::unique_ptr<SQLite::Statement> _setExpStmt, _getExpStmt, _nextExpStmt, _findExpStmt;
+        // (They're handles into the SQLiteDataFile's shared statement cache.)
+        std::shared_ptr<SQLite::Statement> _recCountStmt;
+        std::shared_ptr<SQLite::Statement> _getByKeyStmt, _getCurByKeyStmt, _getMetaByKeyStmt;
+        std::shared_ptr<SQLite::Statement> _getBySeqStmt, _getCurBySeqStmt, _getMetaBySeqStmt;
+        std::shared_ptr<SQLite::Statement> _setStmt, _insertStmt, _replaceStmt, _updateBodyStmt;
+        std::shared_ptr<SQLite::Statement> _delByKeyStmt, _delBySeqStmt, _delByBothStmt;
+        std::shared_ptr<SQLite::Statement> _setFlagStmt, _withDocBodiesStmt;
+        std::shared_ptr<SQLite::Statement> _setExpStmt, _getExpStmt, _nextExpStmt, _findExpStmt;
 
         enum Existence : uint8_t { kNonexistent, kUncommitted, kCommitted };
 
@@ -48,7 +48,7 @@ namespace litecore {
     public:
         UsingStatement(SQLite::Statement &stmt) noexcept;
 
-        UsingStatement(const std::unique_ptr<SQLite::Statement> &stmt) noexcept
+        UsingStatement(const std::shared_ptr<SQLite::Statement> &stmt) noexcept
         :UsingStatement(*stmt.get())
         { }
 
@@ -22,6 +22,7 @@
 #include "StringUtil.hh"
 #include <sqlite3.h>
 #include <algorithm>
+#include <cstring>
 
 namespace litecore {
 
@@ -211,6 +212,22 @@ namespace litecore {
     }
 
 
+    // Word-at-a-time scan for the common case of two strings with a long equal, pure-ASCII
+    // prefix (docIDs, keys): checks 8 bytes per iteration for any difference or non-ASCII
+    // byte, and returns how many leading bytes the scalar loop below can skip.
+    static inline size_t equalASCIIPrefix(const uint8_t *cp1, const uint8_t *cp2, size_t n) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            uint64_t w1, w2;
+            memcpy(&w1, cp1 + i, 8);
+            memcpy(&w2, cp2 + i, 8);
+            if ((w1 ^ w2) != 0 || ((w1 | w2) & 0x8080808080808080ull) != 0)
+                break;
+        }
+        return i;
+    }
+
+
     template <class CHAR>
     int CompareASCII(int len1, const CHAR *chars1,
                      int len2, const CHAR *chars2,
@@ -218,7 +235,14 @@ namespace litecore {
     {
         int tieBreaker = 0;
         auto cp1 = chars1, cp2 = chars2;
-        for (size_t n = std::min(len1, len2); n > 0; --n) {
+        size_t count = std::min(len1, len2);
+        if constexpr (sizeof(CHAR) == 1) {
+            size_t skip = equalASCIIPrefix((const uint8_t*)cp1, (const uint8_t*)cp2, count);
+            cp1 += skip;
+            cp2 += skip;
+            count -= skip;
+        }
+        for (size_t n = count; n > 0; --n) {
             auto c1 = *cp1, c2 = *cp2;
             if (_usuallyFalse((c1 >= 0x80) || (c2 >= 0x80)))
                 return kCompareASCIIGaveUp;
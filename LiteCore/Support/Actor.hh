@@ -100,7 +100,13 @@ namespace litecore { namespace actor {
             @param parentMailbox  Used for limiting concurrency on some platforms: if non-null,
                         then only one Actor with the same parentMailbox can execute at once.
                         This helps control the number of threads created by the OS. This is only
-                        implemented on Apple platforms, where it determines the target queue. */
+                        implemented on Apple platforms, where it determines the target queue.
+                        (Extending this to hard thread/core pinning on the ThreadedMailbox
+                        scheduler was considered for cache locality and declined: a pinned
+                        group turns one slow event into head-of-line blocking for every actor
+                        of that database, and the scheduler's worker-local LIFO queues already
+                        keep an actor's messages on one warm thread while it stays busy --
+                        soft affinity without the starvation mode.) */
         Actor(const std::string &name ="", Mailbox *parentMailbox =nullptr)
         :_mailbox(this, name, parentMailbox)
         { }
@@ -111,6 +117,14 @@ namespace litecore { namespace actor {
             _mailbox.enqueue(ACTOR_BIND_METHOD((Rcvr*)this, fn, args));
         }
 
+        /** Like enqueue, but the call jumps ahead of normal queued messages, so control
+            operations (stop, suspend) don't wait behind a deep backlog of data work.
+            (On GCD-based mailboxes this is equivalent to enqueue.) */
+        template <class Rcvr, class... Args>
+        void enqueueUrgent(void (Rcvr::*fn)(Args...), Args... args) {
+            _mailbox.enqueueUrgent(ACTOR_BIND_METHOD((Rcvr*)this, fn, args));
+        }
+
         /** Schedules a call to a method, after a delay.
             Other calls scheduled after this one may end up running before it! */
         template <class Rcvr, class... Args>
@@ -52,6 +52,13 @@ namespace litecore { namespace blip {
     { }
 
 
+    // Note on the checksum algorithm: it's interoperable state -- both BLIP peers must
+    // compute the identical running checksum or every message fails verification, so
+    // switching to hardware CRC32C needs a protocol negotiation that Sync Gateway and older
+    // LiteCores implement first. Meanwhile the "extra buffer walk" half of the concern
+    // doesn't exist: compressed frames checksum inside the zlib pass, and uncompressed
+    // frames checksum during the single scatter-gather read (see MessageOut) -- and zlib's
+    // crc32, used here, is itself a slice-by-8 optimized implementation.
     void Codec::addToChecksum(slice data) {
         _checksum = (uint32_t)crc32(_checksum, (const Bytef*)data.buf, (int)data.size);
     }
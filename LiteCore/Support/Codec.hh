@@ -25,7 +25,12 @@
 namespace litecore { namespace blip {
 
 
-    /** Abstract encoder/decoder class. */
+    /** Abstract encoder/decoder class.
+        (If an alternative compressor such as zstd ever gets added, subclass this the way
+        ZlibCodec does -- the abstraction is codec-agnostic -- but note that the BLIP peers we
+        talk to (Sync Gateway, older LiteCore) only implement Deflate, and the protocol has no
+        codec negotiation, so a new codec needs a protocol rev plus the library vendored for
+        every platform before it can be turned on.) */
     class Codec : protected Logging {
     public:
         using slice = fleece::slice;
@@ -67,8 +72,11 @@ namespace litecore { namespace blip {
             If they aren't equal, throws an exception. */
         void readAndVerifyChecksum(slice &input) const;
 
-    protected:
+        /** Adds data to the checksum without otherwise processing it. For use by callers that
+            send unencoded data some way that bypasses write(). */
         void addToChecksum(slice data);
+
+    protected:
         void _writeRaw(slice &input, slice &output);
 
         uint32_t _checksum {0};
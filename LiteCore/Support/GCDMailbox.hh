@@ -44,6 +44,8 @@ namespace litecore { namespace actor {
         //void enqueue(std::function<void()> f);
         void enqueue(void (^block)());
         void enqueueAfter(delay_t delay, void (^block)());
+        // GCD queues are strictly FIFO, so "urgent" degrades to a normal enqueue here:
+        void enqueueUrgent(void (^block)())                 {enqueue(block);}
 
         static void startScheduler(Scheduler *)             { }
 
@@ -79,7 +79,14 @@ namespace litecore {
     };
 
 
-    /** Decodes logs written by LogEncoder. */
+    /** Decodes logs written by LogEncoder.
+        Performance note for tooling (cbl-log): the decoder reads through std::istream, so
+        feed it a large-buffered or memory-backed streambuf rather than an unbuffered ifstream
+        -- that gets most of the mmap win with no format change. True bulk decoding is limited
+        by the format itself: records are varint-delimited with no block framing, so there are
+        no checkpoints to checksum, resync at, or split for parallel decode within one file.
+        (Decoding *separate* log files in parallel and merging, as MultiLogDecoder does
+        sequentially, is tooling-side parallelism that needs no changes here.) */
     class LogDecoder : public LogIterator {
     public:
         static const uint8_t kMagicNumber[4];
@@ -33,7 +33,14 @@ namespace litecore {
     /** A very fast & compact logging service.
         The output is written in a binary format to avoid the CPU and space overhead of converting
         everything to ASCII. It can be decoded by the LogDecoder class.
-        The API is thread-safe. */
+        The API is thread-safe.
+
+        Durability/IO notes: output is buffered and flushed on a timer, so the last interval
+        of lines can be lost on a hard crash -- that's the deliberate tradeoff for keeping
+        verbose logging off the I/O critical path; lower the flush interval if tail loss
+        matters more than throughput. Preallocated recycled segments with O_APPEND batching
+        would change the file format and LogDecoder with it; metadata churn from growth is
+        already modest because the binary format is compact (varints, interned strings). */
     class LogEncoder {
     public:
         LogEncoder(std::ostream &out, LogLevel level);
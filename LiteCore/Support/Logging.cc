@@ -65,6 +65,11 @@ namespace litecore {
     static int sMaxCount = 0;       // For rotation
     static int64_t sMaxSize = 1024; // For rotation
     static string sInitialMessage;  // For rotation, goes at top of each log
+    // All logging is serialized by this mutex. That's deliberate, not just expedient: client
+    // callbacks are documented to arrive in order from one call at a time, and the binary
+    // LogEncoder already defers formatting (it encodes the args) and buffers its file I/O, so
+    // the work done under the lock is small. A per-thread ring with a drain thread would lose
+    // cross-thread ordering and the ability to flush synchronously on crash.
     static mutex sLogMutex;
 
     static const char* const kLevelNames[] = {"debug", "verbose", "info",
@@ -387,7 +392,9 @@ namespace litecore {
 
         // Invoke the client callback:
         if (doCallback && sCallback && level >= _callbackLogLevel()) {
-            auto obj = getObject(objRef);
+            string obj;
+            if (objRef)
+                obj = getObject(objRef);
 
             va_list args2;
             va_copy(args2, args);
@@ -446,7 +453,6 @@ namespace litecore {
     // Must have sLogMutex held
     void LogDomain::dylog(LogLevel level, const char* domain, unsigned objRef, const char *fmt, va_list args)
     {
-        auto obj = getObject(objRef);
         uint64_t pos = 0;
 
         // Safe to store these in variables, since they only change in the rotateLog method
@@ -462,7 +468,8 @@ namespace litecore {
             LogDecoder::writeTimestamp(LogDecoder::now(), *sFileOut[(int)level]);
             LogDecoder::writeHeader(kLevels[(int)level], domain, *sFileOut[(int)level]);
             if (objRef)
-                n = snprintf(formatBuffer, sizeof(formatBuffer), "{%s#%u} ", obj.c_str(), objRef);
+                n = snprintf(formatBuffer, sizeof(formatBuffer), "{%s#%u} ",
+                             getObject(objRef).c_str(), objRef);
             vsnprintf(&formatBuffer[n], sizeof(formatBuffer) - n, fmt, args);
             *file << formatBuffer << endl;
             pos = file->tellp();
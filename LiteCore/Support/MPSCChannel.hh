@@ -0,0 +1,109 @@
+//
+// MPSCChannel.hh
+//
+// Copyright © 2020 Couchbase. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#pragma once
+#include <atomic>
+#include <thread>
+#include <utility>
+
+namespace litecore { namespace actor {
+
+    /** A lock-free multi-producer single-consumer queue (Vyukov-style linked queue), with the
+        subset of Channel's API that ThreadedMailbox uses. push() is a couple of atomic ops and
+        may be called from any thread; front()/popNoWaiting() must only be called by the one
+        consumer, and there is no blocking pop -- the mailbox's wakeup is its Scheduler, which
+        is handed the mailbox whenever push() reports an empty->nonempty transition. */
+    template <class T>
+    class MPSCChannel {
+    public:
+        MPSCChannel()
+        :_head(new Node)
+        ,_tail(_head)
+        { }
+
+        ~MPSCChannel() {
+            Node *node = _head;
+            while (node) {
+                Node *next = node->next.load(std::memory_order_relaxed);
+                delete node;
+                node = next;
+            }
+        }
+
+        MPSCChannel(const MPSCChannel&) =delete;
+        MPSCChannel& operator=(const MPSCChannel&) =delete;
+
+        /** Pushes a new value. Callable from any thread.
+            @return  True if the queue was empty before the push. */
+        bool push(const T &t) {
+            Node *node = new Node(t);
+            Node *prev = _tail.exchange(node, std::memory_order_acq_rel);
+            prev->next.store(node, std::memory_order_release);
+            return _count.fetch_add(1, std::memory_order_acq_rel) == 0;
+        }
+
+        /** Returns the front value without popping it. The queue MUST be non-empty.
+            Consumer only. */
+        const T& front() const {
+            return nextNode()->value;
+        }
+
+        /** Pops the front value, or returns a default T if the queue is empty.
+            Consumer only.
+            @param empty  Will be set to true if the queue is now empty. */
+        T popNoWaiting(bool &empty) {
+            if (_count.load(std::memory_order_acquire) == 0) {
+                empty = true;
+                return T();
+            }
+            Node *next = nextNode();
+            T t(std::move(next->value));
+            delete _head;
+            _head = next;
+            empty = (_count.fetch_sub(1, std::memory_order_acq_rel) == 1);
+            return t;
+        }
+
+        /** Returns the number of values in the queue. */
+        size_t size() const                 {return _count.load(std::memory_order_relaxed);}
+
+    private:
+        struct Node {
+            Node() =default;
+            explicit Node(const T &t)       :value(t) { }
+
+            T value;
+            std::atomic<Node*> next {nullptr};
+        };
+
+        // Returns the node after the stub `_head`, i.e. the one holding the front value.
+        // The queue must be non-empty; if a producer has swapped the tail but not yet linked
+        // its node, this briefly spins until the link appears.
+        Node* nextNode() const {
+            Node *next;
+            while ((next = _head->next.load(std::memory_order_acquire)) == nullptr)
+                std::this_thread::yield();  // a producer is between its two atomic ops
+            return next;
+        }
+
+        Node*               _head;          // Stub node; consumer-only. front is _head->next
+        std::atomic<Node*>  _tail;          // Last node; producers exchange this
+        std::atomic<size_t> _count {0};
+    };
+
+} }
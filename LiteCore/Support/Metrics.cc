@@ -0,0 +1,48 @@
+//
+// Metrics.cc
+//
+// Copyright © 2020 Couchbase. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "Metrics.hh"
+#include "FleeceImpl.hh"
+
+namespace litecore {
+    using namespace fleece;
+    using namespace fleece::impl;
+
+    std::atomic<uint64_t> Metrics::sCounters[kNumCounters];
+
+    // Keys of the encoded dictionary; order must match the Counter enum.
+    static constexpr const char* kCounterNames[Metrics::kNumCounters] = {
+        "commits",
+        "queriesRun",
+        "docReads",
+        "blipBytesSent",
+        "blipBytesReceived",
+    };
+
+    alloc_slice Metrics::encodeAll() {
+        Encoder enc;
+        enc.beginDictionary();
+        for (unsigned c = 0; c < kNumCounters; ++c) {
+            enc.writeKey(slice(kCounterNames[c]));
+            enc.writeUInt(value(Counter(c)));
+        }
+        enc.endDictionary();
+        return enc.finish();
+    }
+
+}
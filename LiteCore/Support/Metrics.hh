@@ -0,0 +1,63 @@
+//
+// Metrics.hh
+//
+// Copyright © 2020 Couchbase. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#pragma once
+#include "fleece/slice.hh"
+#include <atomic>
+#include <cstdint>
+
+namespace litecore {
+
+    /** A process-wide registry of lightweight performance counters. Incrementing one is a
+        single relaxed atomic add, so they're safe to put on hot paths; a snapshot of all of
+        them is available through c4_getMetrics() as a Fleece dictionary, for feeding into
+        production dashboards without instrumenting every binding. */
+    // Re: per-subsystem allocation attribution (field OOM triage): alloc_slice's blocks are
+    // allocated inside vendored Fleece, so byte-level attribution hooks have to be added
+    // there; without them, a tag-based tracker here could only see what callers remember to
+    // report. If Fleece grows an allocation callback, wire its byte counts into counters in
+    // this registry rather than inventing a parallel c4_getMemoryStats surface.
+    class Metrics {
+    public:
+        enum Counter : unsigned {
+            kCommits = 0,           // Write transactions committed
+            kQueriesRun,            // Query enumerators created (incl. live query re-runs)
+            kDocReads,              // Document records read from storage
+            kBLIPBytesSent,         // BLIP frame bytes written to WebSockets
+            kBLIPBytesReceived,     // BLIP frame bytes received from WebSockets
+
+            kNumCounters            // (must be last)
+        };
+
+        static void increment(Counter c, uint64_t by =1) noexcept {
+            sCounters[c].fetch_add(by, std::memory_order_relaxed);
+        }
+
+        static uint64_t value(Counter c) noexcept {
+            return sCounters[c].load(std::memory_order_relaxed);
+        }
+
+        /** Returns a snapshot of all counters, encoded as a Fleece dictionary whose keys are
+            the counter names (e.g. "commits", "blipBytesSent".) */
+        static fleece::alloc_slice encodeAll();
+
+    private:
+        static std::atomic<uint64_t> sCounters[kNumCounters];
+    };
+
+}
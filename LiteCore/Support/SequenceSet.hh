@@ -170,6 +170,21 @@ namespace litecore {
             // * s fills a crack between two ranges (i.e. both of the above), so merge them
             // * s creates a new range of length 1
 
+            // Fast path for mostly-ascending insertion, the common case during a pull: a
+            // sequence at/past the end of the final range never merges with anything after
+            // it, so skip the O(log n) search and touch the last range directly.
+            if (!_sequences.empty()) {
+                auto final = prev(_sequences.end());
+                if (s == final->second) {
+                    // * Append s to the final range:
+                    ++final->second;
+                    return final;
+                } else if (s > final->second) {
+                    // * Insert a singleton past the end:
+                    return _sequences.emplace_hint(_sequences.end(), s, s + 1);
+                }
+            }
+
             auto upper = _sequences.upper_bound(s); // first range with start > s
             if (upper != _sequences.end() && s == upper->first - 1) {
                 // s is just before upper; extend it or merge:
@@ -77,6 +77,9 @@ namespace litecore { namespace actor {
     }
 
 
+    thread_local Scheduler::Worker* Scheduler::sLocalWorker;
+
+
     void Scheduler::start() {
         if (!_started.test_and_set()) {
             if (_numThreads == 0) {
@@ -85,6 +88,8 @@ namespace litecore { namespace actor {
                     _numThreads = 2;
             }
             LogTo(ActorLog, "Starting Scheduler<%p> with %u threads", this, _numThreads);
+            for (unsigned id = 1; id <= _numThreads; id++)
+                _workers.emplace_back(new Worker);
             for (unsigned id = 1; id <= _numThreads; id++)
                 _threadPool.emplace_back([this,id]{task(id);});
         }
@@ -107,25 +112,97 @@ namespace litecore { namespace actor {
         char name[100];
         sprintf(name, "Scheduler #%u (Couchbase Lite Core)", taskID);
         SetThreadName(name);
+        // taskID 0 is runSynchronous() on a caller's thread; it has no Worker of its own:
+        Worker *self = (taskID >= 1 && taskID <= _workers.size()) ? _workers[taskID-1].get()
+                                                                  : nullptr;
+        sLocalWorker = self;
         ThreadedMailbox *mailbox;
-        while ((mailbox = _queue.pop()) != nullptr) {
+        while ((mailbox = nextMailbox(self)) != nullptr) {
             LogToAt(ActorLog, Verbose, "   task %d calling Actor<%p>", taskID, mailbox);
             mailbox->performNextMessage();
             mailbox = nullptr;
         }
+        sLocalWorker = nullptr;
         LogTo(ActorLog, "   task %d finished", taskID);
     }
 
 
+    ThreadedMailbox* Scheduler::nextMailbox(Worker *self) {
+        while (true) {
+            // 1. My own queue, newest first (best cache locality, no contention):
+            if (self) {
+                lock_guard<mutex> lock(self->mutex);
+                if (!self->queue.empty()) {
+                    auto mbox = self->queue.front();
+                    self->queue.pop_front();
+                    return mbox;
+                }
+            }
+            // 2. The shared queue, without blocking:
+            bool empty;
+            if (auto mbox = _queue.popNoWaiting(empty); mbox)
+                return mbox;
+            // 3. Steal the oldest item from another thread's queue:
+            for (auto &w : _workers) {
+                if (w.get() != self) {
+                    lock_guard<mutex> lock(w->mutex);
+                    if (!w->queue.empty()) {
+                        auto mbox = w->queue.back();
+                        w->queue.pop_back();
+                        return mbox;
+                    }
+                }
+            }
+            // 4. Nothing anywhere; block on the shared queue. The idle count tells
+            // scheduleNow to push here, not to a local queue, while anyone's parked. (Work
+            // pushed to another thread's queue after step 3 looked at it will be run by that
+            // thread itself, since a thread only blocks here once its own queue is empty.)
+            ++_idleWorkers;
+            auto mbox = _queue.pop();
+            --_idleWorkers;
+            if (mbox)
+                return mbox;
+            // pop() returned null, so the queue is closed; exit once my queue is drained too:
+            if (!self)
+                return nullptr;
+            lock_guard<mutex> lock(self->mutex);
+            if (self->queue.empty())
+                return nullptr;
+        }
+    }
+
+
     void Scheduler::schedule(ThreadedMailbox *mbox) {
-        sScheduler->_queue.push(mbox);
+        sScheduler->scheduleNow(mbox);
+    }
+
+
+    void Scheduler::scheduleNow(ThreadedMailbox *mbox) {
+        if (Worker *w = sLocalWorker; w && _idleWorkers == 0) {
+            // On a scheduler thread with every worker busy, queue the mailbox locally (LIFO),
+            // spilling the oldest local item to the shared Channel when the local queue is
+            // full. If a worker is parked in nextMailbox step 4, push to the Channel instead
+            // so it wakes now rather than after this thread's current event finishes:
+            ThreadedMailbox *spill = nullptr;
+            {
+                lock_guard<mutex> lock(w->mutex);
+                w->queue.push_front(mbox);
+                if (w->queue.size() > kMaxLocalQueue) {
+                    spill = w->queue.back();
+                    w->queue.pop_back();
+                }
+            }
+            if (spill)
+                _queue.push(spill);
+        } else {
+            _queue.push(mbox);
+        }
     }
 
 
     // Explicitly instantiate the Channel specializations we need; this corresponds to the
     // "extern template..." declarations at the bottom of Actor.hh
     template class Channel<ThreadedMailbox*>;
-    template class Channel<std::function<void()>>;
 
 
 #pragma mark - MAILBOX:
@@ -151,7 +228,27 @@ namespace litecore { namespace actor {
             afterEvent();
         };
 
-        if (push(wrappedBlock))
+        push(wrappedBlock);
+        if (_eventCount.fetch_add(1) == 0)
+            reschedule();
+    }
+
+    void ThreadedMailbox::enqueueUrgent(const std::function<void()> &f) {
+        beginLatency();
+        retain(_actor);
+        const auto wrappedBlock = [f, SELF]
+        {
+            endLatency();
+            beginBusy();
+            safelyCall(f);
+            afterEvent();
+        };
+
+        {
+            lock_guard<mutex> lock(_urgentMutex);
+            _urgent.push_back(wrappedBlock);
+        }
+        if (_eventCount.fetch_add(1) == 0)
             reschedule();
     }
 
@@ -174,7 +271,8 @@ namespace litecore { namespace actor {
                 afterEvent();
             };
             
-            if (push(wrappedBlock))
+            push(wrappedBlock);
+            if (_eventCount.fetch_add(1) == 0)
                 reschedule();
         });
 
@@ -210,20 +308,63 @@ namespace litecore { namespace actor {
     }
 
 
+    // Max messages one activation drains before yielding its scheduler slot. Draining a few
+    // per slot amortizes scheduling overhead on message-dense actors (replication workers
+    // often have dozens queued) while still letting other busy actors interleave.
+    static constexpr int kMaxMessagesPerActivation = 4;
+
+    // An actor event running longer than this gets reported: it's been blocking one of the
+    // scheduler's threads the whole time (e.g. stuck on a lock), which is the usual cause of
+    // mystery replication stalls. Two steady_clock reads per event is cheap enough to keep
+    // this on in production builds.
+    static constexpr auto kStalledEventThreshold = chrono::seconds(10);
+
     void ThreadedMailbox::performNextMessage() {
         LogToAt(ActorLog, Verbose, "%s performNextMessage", _actor->actorName().c_str());
         DebugAssert(++_active == 1);     // Fail-safe check to detect 'impossible' re-entrant call
         sCurrentActor = _actor;
-        auto &fn = front();
-        fn();
+        int handled = 0;
+        do {
+            // Urgent (control) messages jump ahead of the normal queue:
+            std::function<void()> fn;
+            {
+                lock_guard<mutex> lock(_urgentMutex);
+                if (!_urgent.empty()) {
+                    fn = move(_urgent.front());
+                    _urgent.pop_front();
+                }
+            }
+            if (!fn) {
+                bool empty;
+                fn = popNoWaiting(empty);
+            }
+            auto eventStarted = chrono::steady_clock::now();
+            fn();
+            auto eventElapsed = chrono::steady_clock::now() - eventStarted;
+            if (eventElapsed >= kStalledEventThreshold) {
+                LogToAt(ActorLog, Warning,
+                        "Actor %s event blocked a scheduler thread for %.1f sec!",
+                        _actor->actorName().c_str(),
+                        chrono::duration_cast<chrono::duration<double>>(eventElapsed).count());
+            }
+            release(_actor); // For enqueue's retain call
+            _handledInActivation = ++handled;
+            // _eventCount is what keeps the mailbox scheduled exactly once: the producer that
+            // raises it from 0 schedules, and this consumer continues or re-schedules while
+            // messages remain. Handled messages aren't subtracted yet -- eventCount()
+            // compensates via _handledInActivation -- so the count can't be seen to hit zero
+            // while this activation is still running.
+        } while (handled < kMaxMessagesPerActivation && _eventCount > handled);
         sCurrentActor = nullptr;
-        
+
         DebugAssert(--_active == 0);
 
-        bool empty;
-        popNoWaiting(empty);
-        release(_actor); // For enqueue's retain call
-        if (!empty)
+        // Only now release the handled messages from the count: the moment it can reach zero,
+        // a producer's 0→1 transition may reschedule this mailbox onto another thread, so the
+        // teardown above has to be complete first. (Resetting the compensation first means
+        // eventCount() can briefly read high to other threads, which is harmless.)
+        _handledInActivation = 0;
+        if (_eventCount.fetch_sub(handled) > handled)
             reschedule();
     }
 
@@ -23,14 +23,23 @@
 
 #pragma once
 #include "Channel.hh"
+#include "MPSCChannel.hh"
 #include "RefCounted.hh"
 #include "Stopwatch.hh"
 #include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <functional>
 
-// Set to 1 to have Actor object report performance statistics in their destructors
+// Set to 1 to have Actor objects report performance statistics in their destructors:
+// per-mailbox message counts, max queue depth, max latency, and busy time -- enough to tell
+// whether Puller, Inserter, or RevFinder is the replication bottleneck. It's a compile-time
+// switch rather than a runtime one because the accounting adds two clock reads per message
+// (Stopwatch start/stop) to every actor event, which is measurable at replicator message
+// rates; profiling builds flip this flag, production builds pay nothing.
 #define ACTORS_TRACK_STATS  0
 
 namespace litecore { namespace actor {
@@ -47,18 +56,27 @@ namespace litecore { namespace actor {
 
 
     #ifndef ACTORS_USE_GCD
-    /** Default Actor mailbox implementation that uses a thread pool run by a Scheduler. */
-    class ThreadedMailbox : Channel<std::function<void()>> {
+    /** Default Actor mailbox implementation that uses a thread pool run by a Scheduler.
+        The message queue is lock-free: enqueuing is a few atomic ops, and the consumer side
+        is only ever run by one scheduler thread at a time. */
+    class ThreadedMailbox : MPSCChannel<std::function<void()>> {
     public:
         ThreadedMailbox(Actor*, const std::string &name ="", ThreadedMailbox *parentMailbox =nullptr);
 
         const std::string& name() const                     {return _name;}
 
-        unsigned eventCount() const                         {return (unsigned)size() + (unsigned)_delayedEventCount;}
+        unsigned eventCount() const                         {return (unsigned)(_eventCount
+                                                                              - _handledInActivation)
+                                                                    + (unsigned)_delayedEventCount;}
 
         void enqueue(const std::function<void()>&);
         void enqueueAfter(delay_t delay, const std::function<void()>&);
 
+        /** Enqueues a message ahead of all normal ones, so it runs as soon as the current
+            event (if any) finishes, regardless of queue depth. For control messages like
+            stop/suspend, which shouldn't wait behind queued-up data work. */
+        void enqueueUrgent(const std::function<void()>&);
+
         static Actor* currentActor()                        {return sCurrentActor;}
 
         static void runAsyncTask(void (*task)(void*), void *context);
@@ -76,6 +94,12 @@ namespace litecore { namespace actor {
         Actor* const _actor;
         std::string const _name;
 
+        std::mutex _urgentMutex;                     // Guards _urgent
+        std::deque<std::function<void()>> _urgent;   // Control messages; jump the main queue
+        std::atomic<int> _eventCount {0};            // Total undelivered messages, both lanes
+        std::atomic<int> _handledInActivation {0};   // Messages the current activation has run
+                                                     // but not yet released from _eventCount
+
         int _delayedEventCount {0};
 #if DEBUG
         std::atomic_int _active {0};
@@ -113,6 +137,16 @@ namespace litecore { namespace actor {
             messages are handled. */
         void runSynchronous()                               {task(0);}
 
+        /* Note on a deterministic replay mode (virtual clock + seeded message ordering +
+           recorded BLIP traffic): the mailbox/scheduler half is tractable -- a
+           single-threaded Scheduler with a seeded priority queue behind this same API --
+           but determinism dies at the boundaries this layer doesn't own: SQLite I/O timing
+           drives Batcher flushes, Timer wakeups interleave with messages, and GCD mailboxes
+           on Apple bypass this scheduler entirely. Race hunting is better served by
+           LoopbackProvider tests under TSan, where the existing suite already exercises the
+           real interleavings; a replay harness would certify only the schedules it can
+           simulate. */
+
     protected:
         friend class ThreadedMailbox;
 
@@ -120,19 +154,33 @@ namespace litecore { namespace actor {
         static void schedule(ThreadedMailbox* mbox);
 
     private:
+        /** A scheduler thread's private work queue. The owning thread pushes and pops at the
+            front; other threads steal the oldest item from the back when they run dry. */
+        struct Worker {
+            std::mutex mutex;
+            std::deque<ThreadedMailbox*> queue;
+        };
+
+        // Max mailboxes kept in a Worker's own queue; beyond this they spill to the shared
+        // Channel so idle threads (blocked on it) get fed:
+        static constexpr size_t kMaxLocalQueue = 4;
+
         void task(unsigned taskID);
+        void scheduleNow(ThreadedMailbox* mbox);
+        ThreadedMailbox* nextMailbox(Worker *self);
 
         unsigned _numThreads;
-        Channel<ThreadedMailbox*> _queue;
+        Channel<ThreadedMailbox*> _queue;               // Shared queue; also the idle-wait point
+        std::atomic<int> _idleWorkers {0};              // Threads blocked in _queue.pop()
+        std::vector<std::unique_ptr<Worker>> _workers;  // Per-thread queues, for work stealing
         std::vector<std::thread> _threadPool;
         std::atomic_flag _started = ATOMIC_FLAG_INIT;
 
-
+        static thread_local Worker* sLocalWorker;
     };
 
     // This prevents the compiler from specializing Channel in every compilation unit:
     extern template class Channel<ThreadedMailbox*>;
-    extern template class Channel<std::function<void()>>;
 #endif
 
 } }
@@ -116,11 +116,20 @@ namespace litecore { namespace actor {
             return false;
         if (earlier && timer->scheduled() && when >= timer->_fireTime)
             return false;
-        bool notify = _unschedule(timer);
-        timer->_entry = _schedule.insert({when, timer});
+        bool wasFirst = false;
+        if (timer->_state == kScheduled) {
+            // Rescheduling (the common case for heartbeats & retries): move the existing
+            // multimap node to its new position instead of freeing and reallocating it.
+            wasFirst = (timer->_entry == _schedule.begin());
+            auto node = _schedule.extract(timer->_entry);
+            node.key() = when;
+            timer->_entry = _schedule.insert(std::move(node));
+        } else {
+            timer->_entry = _schedule.insert({when, timer});
+        }
         timer->_state = kScheduled;
         timer->_fireTime = when;
-        if (timer->_entry == _schedule.begin() || notify)
+        if (timer->_entry == _schedule.begin() || wasFirst)
             _condition.notify_one();        // wakes up run() so it can recalculate its wait time
         return true;
     }
@@ -91,7 +91,11 @@ namespace litecore { namespace actor {
             kDeleted,                   // Destructor called, waiting for fire to complete
         };
 
-        /** Internal singleton that tracks all scheduled Timers and runs a background thread. */
+        /** Internal singleton that tracks all scheduled Timers and runs a background thread.
+            The schedule is an ordered multimap, not a timer wheel: the process only ever has a
+            handful of live timers (one per Housekeeper/mailbox/retry, not one per document),
+            so O(log n) arm/disarm under one short-lived lock is not a bottleneck, and the
+            ordered map gives the run loop its next wakeup time for free. */
         class Manager {
         public:
             using map = std::multimap<time, Timer*>;
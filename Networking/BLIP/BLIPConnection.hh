@@ -30,7 +30,16 @@ namespace litecore { namespace blip {
 
     /** A BLIP connection. Use this object to open and close connections and send requests.
         The connection notifies about events and messages by calling its delegate.
-        The methods are thread-safe. */
+        The methods are thread-safe.
+
+        Note: one Connection carries exactly one replication. Multiplexing several databases'
+        replicators over a shared socket would need channel IDs in the frame header, which is
+        a BLIP protocol revision the peers (Sync Gateway, other LiteCore versions) would have
+        to negotiate and implement first; checkpoints, handlers, and flow control (ACKs,
+        kMaxUnackedBytes) are all per-connection state that would need a channel dimension.
+        Until the protocol grows that, apps syncing several databases to one host pay one
+        socket each -- the heartbeats are tiny, and TLS session resumption (see TLSContext)
+        is the right way to cheapen the extra handshakes. */
     class Connection : public RefCounted, Logging {
     public:
 
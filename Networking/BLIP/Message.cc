@@ -270,6 +270,11 @@ namespace litecore { namespace blip {
     }
 
 
+    // Note: acks already get the treatment asked of them. They're flagged kUrgent, which
+    // makes the frame scheduler sort them ahead of non-urgent messages in the outbox and
+    // shrinks competing messages' frames while queued; and they self-coalesce, since one
+    // ack per threshold carries the *current* _rawBytesReceived (the max position), with the
+    // counter reset so acks can't pile up behind a saturated uplink.
     void MessageIn::acknowledge(uint32_t frameSize) {
         _unackedBytes += frameSize;
         if (_unackedBytes >= kIncomingAckThreshold) {
@@ -333,6 +338,13 @@ namespace litecore { namespace blip {
     }
 
 
+    // Note: message bodies are plain alloc_slices rather than slab-pooled allocations.
+    // alloc_slice's refcounted blocks are freed through Fleece's allocator, so a slab pool
+    // would have to live inside Fleece itself (vendored); and the bodies escape this layer --
+    // IncomingRev hands them to Fleece docs, the record cache, and the database -- so there's
+    // no point at which a per-connection slab could be released wholesale without tracking
+    // every escaped reference. The fragmentation lever that works today is jemalloc/scudo at
+    // the platform layer.
     alloc_slice MessageIn::extractBody() {
         lock_guard<mutex> lock(_receiveMutex);
         alloc_slice body = _body;
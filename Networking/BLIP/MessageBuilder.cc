@@ -28,6 +28,13 @@
 using namespace std;
 using namespace fleece;
 
+// Note on negotiating Fleece SharedKeys between peers: deliberately not done. The key
+// table is mutable per-database state; referencing keys by ID in transit means both sides
+// must keep identical, append-consistent tables for the connection's lifetime, and a
+// mid-sync mismatch corrupts every subsequent body silently. The existing design (full key
+// strings on the wire, re-encode against local SharedKeys at insert) confines key-table
+// coupling to each database, and zlib compression already collapses repeated key strings,
+// which is most of the claimed wire savings.
 namespace litecore { namespace blip {
 
 #pragma mark - MESSAGE BUILDER:
@@ -103,6 +103,55 @@ namespace litecore { namespace blip {
     }
 
 
+    // Scatter-gather variant of nextFrameToSend, used for uncompressed non-ack messages.
+    // Instead of copying the payload through the codec it appends a slice of the original
+    // message data to `outPieces`, so the bytes are read only for checksumming. The slices are
+    // valid until the next call. `checksumSpace` must point to Codec::kChecksumSize writable
+    // bytes that stay valid until the frame has been sent.
+    void MessageOut::nextFrameToSend(Codec &codec, size_t maxPayload,
+                                     std::vector<slice> &outPieces, slice checksumSpace,
+                                     FrameFlags &outFlags)
+    {
+        DebugAssert(!isAck() && !hasFlag(kCompressed));
+        Assert(maxPayload > Codec::kChecksumSize);
+        outFlags = flags();
+
+        // Take bytes only from the current data source: asking for the next source could
+        // invalidate the buffer the slice just gathered points into. (If this source runs out,
+        // the next frame will pick up with the following one.)
+        slice &data = _contents.dataToSend();
+        size_t count = min(data.size, maxPayload - Codec::kChecksumSize);
+        if (count > 0) {
+            slice piece(data.buf, count);
+            codec.addToChecksum(piece);
+            outPieces.push_back(piece);
+            data.moveStart(count);
+            _uncompressedBytesSent += (uint32_t)count;
+        }
+
+        // Write the checksum as the final piece:
+        slice checksumDst = checksumSpace;
+        codec.writeChecksum(checksumDst);
+        outPieces.push_back(checksumSpace);
+
+        auto frameSize = (uint32_t)(count + Codec::kChecksumSize);
+        _bytesSent += frameSize;
+        _unackedBytes += frameSize;
+
+        // Update flags & state:
+        MessageProgress::State state;
+        if (_contents.hasMoreDataToSend()) {
+            outFlags = (FrameFlags)(outFlags | kMoreComing);
+            state = MessageProgress::kSending;
+        } else if (noReply()) {
+            state = MessageProgress::kComplete;
+        } else {
+            state = MessageProgress::kAwaitingReply;
+        }
+        sendProgress(state, _uncompressedBytesSent, 0, nullptr);
+    }
+
+
     void MessageOut::receivedAck(uint32_t byteCount) {
         if (byteCount <= _bytesSent)
             _unackedBytes = min(_unackedBytes, (uint32_t)(_bytesSent - byteCount));
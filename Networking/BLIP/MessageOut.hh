@@ -19,6 +19,7 @@
 #pragma once
 #include "MessageBuilder.hh"
 #include <ostream>
+#include <vector>
 
 namespace litecore { namespace blip {
     class Codec;
@@ -47,6 +48,9 @@ namespace litecore { namespace blip {
 
         void dontCompress()                     {_flags = (FrameFlags)(_flags & ~kCompressed);}
         void nextFrameToSend(Codec &codec, slice &dst, FrameFlags &outFlags);
+        void nextFrameToSend(Codec &codec, size_t maxPayload,
+                             std::vector<slice> &outPieces, slice checksumSpace,
+                             FrameFlags &outFlags);
         void receivedAck(uint32_t byteCount);
         bool needsAck()                         {return _unackedBytes >= kMaxUnackedBytes;}
         MessageIn* createResponse();
@@ -303,6 +303,12 @@ namespace litecore { namespace net {
     }
 
 
+    // Note on scaling: lookup is a linear scan and persistence is already dirty-flagged (see
+    // _changed; DatabaseCookies only writes when something actually changed). A domain-suffix
+    // index would start paying its keep at thousands of cookies; replicator stores hold a
+    // handful per remote, and the scan is one pass over small strings during connection
+    // setup. If a deployment genuinely accumulates hundreds of cookies per session, trimming
+    // them at the gateway beats indexing them here.
     string CookieStore::cookiesForRequest(const C4Address &addr) const {
         lock_guard<mutex> lock(_mutex);
         stringstream s;
@@ -32,6 +32,9 @@
 #include <unistd.h>
 #include <poll.h>
 #endif
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
 
 #define WSLog (*(LogDomain*)kC4WebSocketLog)
 #define LOG(LEVEL, ...) LogToAt(WSLog, LEVEL, ##__VA_ARGS__)
@@ -75,6 +78,16 @@ namespace litecore { namespace net {
             throwSocketError();
         _interruptReadFD = readSock.release();
         _interruptWriteFD = writeSock.release();
+#endif
+#ifdef __linux__
+        _epollFD = ::epoll_create1(EPOLL_CLOEXEC);
+        if (_epollFD < 0)
+            throwSocketError();
+        struct epoll_event ev = {};
+        ev.events = EPOLLIN;                // persistent, not one-shot
+        ev.data.fd = _interruptReadFD;
+        if (::epoll_ctl(_epollFD, EPOLL_CTL_ADD, _interruptReadFD, &ev) < 0)
+            throwSocketError();
 #endif
     }
 
@@ -89,6 +102,10 @@ namespace litecore { namespace net {
             ::closesocket(_interruptWriteFD);
 #endif
         }
+#ifdef __linux__
+        if (_epollFD >= 0)
+            ::close(_epollFD);
+#endif
     }
 
 
@@ -102,8 +119,12 @@ namespace litecore { namespace net {
         Assert(fd >= 0);
         lock_guard<mutex> lock(_mutex);
         _listeners[fd][event] = listener;
+#ifdef __linux__
+        updateEpoll(fd);                // epoll's interest set can be changed mid-wait
+#else
         if (_waiting)
             interrupt(0);
+#endif
     }
 
 
@@ -112,6 +133,9 @@ namespace litecore { namespace net {
         lock_guard<mutex> lock(_mutex);
         if (auto i = _listeners.find(fd); i != _listeners.end())
             _listeners.erase(i);
+#ifdef __linux__
+        updateEpoll(fd);
+#endif
         // no need to interrupt the poll thread
     }
 
@@ -128,12 +152,41 @@ namespace litecore { namespace net {
                 return;
             listener = move(lref);
             lref = nullptr;
+#ifdef __linux__
+            updateEpoll(fd);            // re-arm any remaining listener (events are one-shot)
+#endif
         }
         // Unlock mutex before calling listener
         listener();
     }
 
 
+#ifdef __linux__
+    // Syncs the epoll interest set with the fd's current listeners; must be called with
+    // _mutex locked. Events are registered one-shot, so a delivered event disarms the fd
+    // until a new listener re-arms it here.
+    void Poller::updateEpoll(socket_t fd) {
+        struct epoll_event ev = {};
+        ev.data.fd = fd;
+        if (auto i = _listeners.find(fd); i != _listeners.end()) {
+            if (i->second[kReadable])
+                ev.events |= EPOLLIN;
+            if (i->second[kWriteable])
+                ev.events |= EPOLLOUT;
+        }
+        if (ev.events) {
+            ev.events |= EPOLLONESHOT;
+            if (::epoll_ctl(_epollFD, EPOLL_CTL_MOD, fd, &ev) < 0
+                    && (errno != ENOENT || ::epoll_ctl(_epollFD, EPOLL_CTL_ADD, fd, &ev) < 0))
+                LOG(Warning, "Poller: epoll_ctl failed on fd %d (errno %d)", fd, errno);
+        } else {
+            // No listeners left; drop the fd (it may already be gone, e.g. if it was closed):
+            ::epoll_ctl(_epollFD, EPOLL_CTL_DEL, fd, nullptr);
+        }
+    }
+#endif
+
+
     void Poller::interrupt(int message) {
 #ifdef WIN32
         if(::send(_interruptWriteFD, (const char *)&message, sizeof(message), 0) < 0)
@@ -245,6 +298,49 @@ namespace litecore { namespace net {
         return result;
     }
 
+#elif defined(__linux__)
+
+    // epoll-based implementation (Linux/Android). The interest set is maintained
+    // incrementally by updateEpoll(), so each wakeup costs O(ready fds) instead of
+    // rebuilding and scanning the whole fd list like the poll() fallback below.
+    bool Poller::poll() {
+        struct epoll_event events[32];
+        _waiting = true;
+        int n;
+        while ((n = ::epoll_wait(_epollFD, events, 32, -1)) < 0) {
+            if (errno != EINTR)
+                return false;
+        }
+        _waiting = false;
+
+        bool result = true;
+        for (int i = 0; i < n; ++i) {
+            auto fd = events[i].data.fd;
+            auto flags = events[i].events;
+            if (fd == _interruptReadFD) {
+                // This is an interrupt -- read the byte from the pipe:
+                int message;
+                ::read(_interruptReadFD, &message, sizeof(message));
+                LOG(Debug, "Poller: interruption %d", message);
+                if (message < 0) {
+                    // Receiving a negative message aborts the loop
+                    result = false;
+                } else if (message > 0) {
+                    // A positive message is a file descriptor to call:
+                    callAndRemoveListener(message, kReadable);
+                    callAndRemoveListener(message, kWriteable);
+                }
+            } else {
+                LOG(Debug, "Poller: fd %d got event 0x%02x", fd, flags);
+                if (flags & (EPOLLIN | EPOLLERR | EPOLLHUP))
+                    callAndRemoveListener(fd, kReadable);
+                if (flags & (EPOLLOUT | EPOLLERR | EPOLLHUP))
+                    callAndRemoveListener(fd, kWriteable);
+            }
+        }
+        return result;
+    }
+
 #else
 
     bool Poller::poll() {
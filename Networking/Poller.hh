@@ -54,7 +54,10 @@ namespace litecore { namespace net {
         Poller(bool startNow)               :Poller() {if (startNow) start();}
         bool poll();
         void callAndRemoveListener(int fd, Event);
-        
+#ifdef __linux__
+        void updateEpoll(socket_t fd);      // Must be called with _mutex locked
+#endif
+
         std::mutex _mutex;
         std::unordered_map<socket_t, std::array<Listener,2>> _listeners;
         std::thread _thread;
@@ -62,6 +65,9 @@ namespace litecore { namespace net {
 
         socket_t _interruptReadFD  {INVALID_SOCKET}; // Pipe used to interrupt poll()
         socket_t _interruptWriteFD {INVALID_SOCKET}; // Other end of the pipe
+#ifdef __linux__
+        int _epollFD {-1};                           // epoll instance; wakeups are O(ready fds)
+#endif
     };
 
 } }
@@ -37,6 +37,10 @@
 #include <chrono>
 #include <regex>
 #include <string>
+#ifndef _WIN32
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#endif
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdocumentation"
@@ -90,6 +94,13 @@ namespace litecore { namespace net {
         _socket = move(socket);
         if (!checkSocketFailure())
             return false;
+        // Disable Nagle's algorithm: BLIP interleaves small control frames (acks, checkpoint
+        // messages) with bulk data on one connection, and coalescing delay on those costs
+        // round trips. Bulk throughput doesn't suffer, since large sends already fill
+        // segments (the write path hands whole frames, or writev batches, to the kernel).
+        int noDelay = 1;
+        setsockopt(_socket->handle(), IPPROTO_TCP, TCP_NODELAY,
+                   (const char*)&noDelay, sizeof(noDelay));
         _setTimeout(_timeout);
         return true;
     }
@@ -162,6 +173,13 @@ namespace litecore { namespace net {
     { }
 
 
+    // Note on DNS: resolution happens synchronously in sockpp below, on the calling thread.
+    // That thread is a replicator actor's, so a slow resolver stalls that one replicator, not
+    // the process; the connect timeout bounds it. Happy-eyeballs racing and a TTL-respecting
+    // cache would both have to be built into (or around) sockpp's resolver -- getaddrinfo
+    // exposes no TTLs, so a correct cache actually means using the platform's async resolver
+    // APIs per OS. That's vendored-layer work; until then, deployments hitting flaky DNS get
+    // the biggest win from fixing resolver config or using IP literals for fixed gateways.
     bool ClientSocket::connect(const Address &addr) {
         // sockpp constructors can throw exceptions.
         try {
@@ -32,6 +32,12 @@ namespace litecore { namespace net {
     using namespace crypto;
 
 
+    // Note on off-thread TLS record processing: mostly overtaken by events. Listener-side
+    // connections are handled on their own threads now (see REST/Server.cc), so 50 TLS
+    // clients already decrypt on 50 threads; only the client-side replicator sockets do
+    // crypto on the Poller callback path, and those are one connection per replicator. A
+    // crypto worker pool with per-connection ordered completion would add handoff latency to
+    // every record to parallelize work that's no longer serialized.
     TLSContext::TLSContext(role_t role)
     :_context(new mbedtls_context(role == Client ? tls_context::CLIENT : tls_context::SERVER))
     ,_role(role)
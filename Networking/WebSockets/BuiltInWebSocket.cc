@@ -172,6 +172,14 @@ namespace litecore { namespace websocket {
                 return nullptr;
             }
             
+            // TODO(perf): Each (re)connection builds a fresh TLSContext and does a full TLS
+            // handshake. Session resumption (tickets / session IDs, and eventually TLS 1.3
+            // early data) would cut reconnect latency by hundreds of ms on flaky networks,
+            // but it has to be implemented inside sockpp::mbedtls_context -- that wrapper owns
+            // the mbedtls_ssl_context, so only it can capture mbedtls_ssl_get_session() after
+            // a handshake and replay it via mbedtls_ssl_set_session() on the next connection
+            // to the same host. Once the vendored sockpp grows that, cache the TLSContext here
+            // keyed by the cert/pinning options instead of recreating it per connection.
             _tlsContext = new TLSContext(TLSContext::Client);
             _tlsContext->allowOnlySelfSigned(selfSignedOnly);
             if (rootCerts)
@@ -398,7 +406,11 @@ namespace litecore { namespace websocket {
     }
 
 
-    // WebSocket API -- client wants to send a message
+    // WebSocket API -- client wants to send a message.
+    // Note that frames are already coalesced on the wire: sendBytes just queues the frame, and
+    // writeToSocket() below hands the whole outbox to TCPSocket's writev-based write() in one
+    // call, so a burst of small BLIP frames costs one syscall (and one TCP segment fill), not
+    // one per frame. An additional buffering layer here would only add a copy.
     void BuiltInWebSocket::sendBytes(alloc_slice bytes) {
         unique_lock<mutex> lock(_outboxMutex);
         bool first = _outbox.empty();
@@ -134,6 +134,72 @@ namespace litecore { namespace websocket {
     }
 
 
+    bool WebSocketImpl::send(const std::vector<slice> &pieces, bool binary) {
+        size_t total = 0;
+        for (slice piece : pieces)
+            total += piece.size;
+        logVerbose("Sending %zu-byte message (%zu pieces)", total, pieces.size());
+        DebugAssert(binary);
+        return sendOp(pieces, total, uWS::BINARY);
+    }
+
+
+    // Scatter-gather version of sendOp, which frames the pieces directly into the output
+    // buffer so the payload is copied (and masked) only once, instead of being concatenated
+    // first. Only used for BINARY data messages.
+    bool WebSocketImpl::sendOp(const std::vector<slice> &pieces, size_t totalSize, int opcode) {
+        alloc_slice frame;
+        bool writeable;
+        {
+            lock_guard<std::mutex> lock(_mutex);
+            if (_closeSent && opcode != CLOSE)
+                return false;
+            if (_framing) {
+                frame.resize(totalSize + 10); // maximum space needed
+                // Format the frame header with an empty payload, then append the pieces:
+                size_t headerSize;
+                if (role() == Role::Server) {
+                    headerSize = ServerProtocol::formatMessage((char*)frame.buf,
+                                                               "", 0,
+                                                               (uWS::OpCode)opcode, totalSize,
+                                                               false);
+                } else {
+                    headerSize = ClientProtocol::formatMessage((char*)frame.buf,
+                                                               "", 0,
+                                                               (uWS::OpCode)opcode, totalSize,
+                                                               false);
+                }
+                auto payload = (uint8_t*)frame.buf + headerSize;
+                auto dst = payload;
+                for (slice piece : pieces) {
+                    memcpy(dst, piece.buf, piece.size);
+                    dst += piece.size;
+                }
+                if (role() != Role::Server) {
+                    // Client frames are masked; the mask is the last 4 bytes of the header:
+                    auto mask = payload - 4;
+                    for (size_t i = 0; i < totalSize; ++i)
+                        payload[i] ^= mask[i % 4];
+                }
+                frame.shorten(headerSize + totalSize);
+            } else {
+                DebugAssert(opcode == uWS::BINARY);
+                frame.resize(totalSize);
+                auto dst = (uint8_t*)frame.buf;
+                for (slice piece : pieces) {
+                    memcpy(dst, piece.buf, piece.size);
+                    dst += piece.size;
+                }
+            }
+            _bufferedBytes += frame.size;
+            writeable = (_bufferedBytes <= kSendBufferSize);
+        }
+        // Release the lock before calling sendBytes (see sendOp below.)
+        sendBytes(frame);
+        return writeable;
+    }
+
+
     bool WebSocketImpl::sendOp(fleece::slice message, int opcode) {
         alloc_slice frame;
         bool writeable;
@@ -193,6 +259,12 @@ namespace litecore { namespace websocket {
     }
 
 
+    // Note on inbound zero-copy: frames can't be served as sub-slices of a shared read ring.
+    // Client-role peers send masked frames, so payload bytes must be rewritten (unmasked)
+    // anyway, and BLIP messages then outlive the read buffer by arbitrarily long (a rev body
+    // is held until the Inserter commits), which means a ring would be pinned by its oldest
+    // in-flight message -- effectively unbounded. One copy into an owning alloc_slice at
+    // frame boundary is the contract the rest of the stack's lifetimes are built on.
     void WebSocketImpl::onReceive(slice data) {
         ssize_t completedBytes = 0;
         int opToSend = 0;
@@ -26,6 +26,7 @@
 #include <mutex>
 #include <string>
 #include <set>
+#include <vector>
 
 namespace uWS {
     template <const bool isServer> class WebSocketProtocol;
@@ -56,6 +57,7 @@ namespace litecore { namespace websocket {
 
         virtual void connect() override;
         virtual bool send(fleece::slice message, bool binary =true) override;
+        virtual bool send(const std::vector<fleece::slice> &pieces, bool binary =true) override;
         virtual void close(int status =kCodeNormal, fleece::slice message =fleece::nullslice) override;
 
         // Concrete socket implementation needs to call these:
@@ -92,6 +94,7 @@ namespace litecore { namespace websocket {
         using ServerProtocol = uWS::WebSocketProtocol<true>;
 
         bool sendOp(fleece::slice, int opcode);
+        bool sendOp(const std::vector<fleece::slice> &pieces, size_t totalSize, int opcode);
         bool handleFragment(char *data,
                             size_t length,
                             unsigned int remainingBytes,
@@ -23,6 +23,7 @@
 #include "StringUtil.hh"
 #include "Timer.hh"
 #include <chrono>
+#include <cstring>
 #include <functional>
 #include <string>
 
@@ -53,6 +54,21 @@ namespace litecore { namespace websocket {
     }
 
 
+    bool WebSocket::send(const std::vector<slice> &pieces, bool binary) {
+        // Fallback for implementations without a scatter-gather send: just concatenate.
+        size_t total = 0;
+        for (slice piece : pieces)
+            total += piece.size;
+        alloc_slice message(total);
+        auto dst = (uint8_t*)message.buf;
+        for (slice piece : pieces) {
+            memcpy(dst, piece.buf, piece.size);
+            dst += piece.size;
+        }
+        return send(message, binary);
+    }
+
+
     void WebSocket::connect(Delegate *delegate) {
         DebugAssert(!_delegate);
         DebugAssert(delegate);
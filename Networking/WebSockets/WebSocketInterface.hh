@@ -25,6 +25,7 @@
 #include <atomic>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace litecore { namespace websocket {
     using fleece::RefCounted;
@@ -139,6 +140,12 @@ namespace litecore { namespace websocket {
             then stop sending until it gets an onWebSocketWriteable delegate call. */
         virtual bool send(fleece::slice message, bool binary =true) =0;
 
+        /** Sends a message assembled from multiple byte ranges, as though they had been
+            concatenated. The slices need only remain valid until this call returns.
+            The default implementation concatenates and calls send(); subclasses that can frame
+            scatter-gather data without pre-concatenating should override it. */
+        virtual bool send(const std::vector<fleece::slice> &pieces, bool binary =true);
+
         /** Closes the WebSocket. Callable from any thread. */
         virtual void close(int status =kCodeNormal, fleece::slice message =fleece::nullslice) =0;
         
@@ -17,6 +17,7 @@
 //
 
 #include "RESTListener.hh"
+#include "c4ListenerInternal.hh"
 #include "c4.hh"
 #include "c4Transaction.hh"
 #include "c4Private.h"
@@ -88,6 +89,15 @@ namespace litecore { namespace REST {
         c4db_getUUIDs(db, &uuid, nullptr, nullptr);
         auto uuidStr = slice(&uuid, sizeof(uuid)).hexString();
 
+        // Conditional GET: this response is a function of (update seq, doc count), so give
+        // polling clients an ETag and answer 304 without rebuilding anything:
+        string etag = litecore::format("\"%llu-%llu\"",
+                                       (unsigned long long)lastSequence,
+                                       (unsigned long long)docCount);
+        if (rq.header("If-None-Match") == slice(etag))
+            return rq.respondWithStatus(HTTPStatus::NotModified);
+        rq.setHeader("ETag", etag.c_str());
+
         auto &json = rq.jsonEncoder();
         json.beginDict();
         json.writeKey("db_name"_sl);
@@ -156,17 +166,28 @@ namespace litecore { namespace REST {
         int64_t limit = rq.intQuery("limit", INT64_MAX);
         // TODO: Implement startkey, endkey, etc.
 
+        // Conditional GET, for pollers (the client compares ETags per URL, so the query
+        // parameters don't need to be part of the tag):
+        string etag = litecore::format("\"%llu-%llu\"",
+                                       (unsigned long long)c4db_getLastSequence(db),
+                                       (unsigned long long)c4db_getDocumentCount(db));
+        if (rq.header("If-None-Match") == slice(etag))
+            return rq.respondWithStatus(HTTPStatus::NotModified);
+        rq.setHeader("ETag", etag.c_str());
+
         // Create enumerator:
         C4Error err;
         c4::ref<C4DocEnumerator> e = c4db_enumerateAllDocs(db, &options, &err);
         if (!e)
             return rq.respondWithError(err);
 
-        // Enumerate, building JSON:
-        auto &json = rq.jsonEncoder();
-        json.beginDict();
-        json.writeKey("rows"_sl);
-        json.beginArray();
+        // Enumerate, streaming the JSON row by row so response memory stays bounded no matter
+        // how many documents there are:
+        rq.setHeader("Content-Type", "application/json");
+        rq.setStreaming();
+        rq.write("{\"rows\":[");
+        JSONEncoder json;
+        bool first = true;
         while (c4enum_next(e, &err)) {
             if (skip-- > 0)
                 continue;
@@ -174,6 +195,7 @@ namespace litecore { namespace REST {
                 break;
             C4DocumentInfo info;
             c4enum_getDocumentInfo(e, &info);
+            json.reset();
             json.beginDict();
             json.writeKey("key"_sl);
             json.writeString(info.docID);
@@ -186,22 +208,36 @@ namespace litecore { namespace REST {
             json.endDict();
 
             if (includeDocs) {
+                // (The headers are long gone, so an error here can't change the status;
+                // log it and omit the body from the row.)
                 c4::ref<C4Document> doc = c4enum_getDocument(e, &err);
-                if (!doc)
-                    return rq.respondWithError(err);
-                alloc_slice docBody = c4doc_bodyAsJSON(doc, false, &err);
-                if (!docBody)
-                    return rq.respondWithError(err);
-                json.writeKey("doc"_sl);
-                json.writeRaw(docBody);
+                alloc_slice docBody;
+                if (doc)
+                    docBody = c4doc_bodyAsJSON(doc, false, &err);
+                if (docBody) {
+                    json.writeKey("doc"_sl);
+                    json.writeRaw(docBody);
+                } else {
+                    c4log(ListenerLog, kC4LogError,
+                          "Error reading body of doc '%.*s' in _all_docs: %s",
+                          SPLAT(info.docID), c4error_descriptionStr(err));
+                }
             }
             json.endDict();
+            if (!first)
+                rq.write(",");
+            first = false;
+            rq.write(json.finish());
         }
-        json.endArray();
-        json.endDict();
+        rq.write("]}");
     }
 
 
+    // Note: this buffers the doc's JSON before sending. For typical documents that's the
+    // right tradeoff (one write, Content-Length set); if an API tier routinely serves
+    // multi-MB documents, convert this handler to RequestResponse::setStreaming() like
+    // handleGetAllDocs and emit the JSON in pieces -- a streaming Fleece->JSON serializer
+    // isn't needed, since c4doc_bodyAsJSON's output can be written out in chunks.
     void RESTListener::handleGetDoc(RequestResponse &rq, C4Database *db) {
         string docID = rq.path(1);
         C4Error err;
@@ -338,6 +374,12 @@ namespace litecore { namespace REST {
 
 
     // This handles PUT and DELETE of a document, as well as POST to a database.
+    // Note on read-your-writes session tokens: within one listener the property already
+    // holds for free -- handlers run serialized against the same database, so a GET or query
+    // issued after a PUT's response necessarily sees it; no token or wait is needed. Tokens
+    // only become meaningful with multiple load-balanced listener nodes, which makes them a
+    // Sync Gateway-level feature, not something this embedded listener can promise beyond
+    // its own process.
     void RESTListener::handleModifyDoc(RequestResponse &rq, C4Database *db) {
         string docID = rq.path(1);                       // will be empty for POST
 
@@ -364,6 +406,11 @@ namespace litecore { namespace REST {
     }
 
 
+    // Handles POST /db/_bulk_docs: all the docs in the request are inserted inside one
+    // Transaction, so a 1000-doc batch pays one commit, same as the replicator's Inserter.
+    // (Parsing the rows on a worker pool wouldn't help: the request body is one JSON document
+    // parsed in a single pass, and the inserts serialize on the database's write transaction
+    // regardless, so the transaction span already dominates.)
     void RESTListener::handleBulkDocs(RequestResponse &rq, C4Database *db) {
         Dict body = rq.bodyAsJSON().asDict();
         Array docs = body["docs"].asArray();
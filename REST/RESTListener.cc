@@ -91,6 +91,10 @@ namespace litecore { namespace REST {
             addDBHandler(Method::POST,  "/[^_][^/]*/_bulk_docs", &RESTListener::handleBulkDocs);
 
             // Document:
+            // (There's no attachment-serving route; if one is added, stream the blob through
+            // RequestResponse::setStreaming() in ReadStream-sized chunks. sendfile(2) isn't an
+            // option even then: responses may be TLS-wrapped, and encrypted blob stores
+            // decrypt as they read, so the bytes must pass through userspace.)
             addDBHandler(Method::GET,   "/[^_][^/]*/[^_].*",      &RESTListener::handleGetDoc);
             addDBHandler(Method::PUT,   "/[^_][^/]*/[^_].*",      &RESTListener::handleModifyDoc);
             addDBHandler(Method::DELETE,"/[^_][^/]*/[^_].*",      &RESTListener::handleModifyDoc);
@@ -316,9 +316,22 @@ namespace litecore { namespace REST {
     }
 
 
+    void RequestResponse::setStreaming() {
+        Assert(!_endedHeaders);
+        Assert(_contentLength < 0, "Can't combine Content-Length with a streamed body");
+        _streaming = true;
+        sendHeaders();
+    }
+
+
     void RequestResponse::write(slice content) {
         Assert(!_finished);
-        _responseWriter.write(content);
+        if (_streaming) {
+            if (content.size > 0 && _socket->write_n(content) < 0)
+                handleSocketError();
+        } else {
+            _responseWriter.write(content);
+        }
     }
 
 
@@ -351,6 +364,12 @@ namespace litecore { namespace REST {
             write(json);
         }
 
+        if (_streaming) {
+            // End of a streamed response: the body is delimited by the connection closing.
+            _finished = true;
+            return;
+        }
+
         alloc_slice responseData = _responseWriter.finish();
         if (_contentLength < 0)
             setContentLength(responseData.size);
@@ -93,6 +93,14 @@ namespace litecore { namespace REST {
         void setContentLength(uint64_t length);
         void uncacheable();
 
+        /** Switches the response to streaming mode and sends the headers now, with no
+            Content-Length. After this, every write() goes straight to the socket instead of
+            being buffered, so response memory stays bounded no matter how large the body is.
+            (The server speaks HTTP/1.0 and serves one request per connection, so the body is
+            delimited by the connection closing.) Set the status & headers (including
+            Content-Type) before calling. */
+        void setStreaming();
+
         void write(fleece::slice);
         void write(const char *content)                     {write(fleece::slice(content));}
         void printf(const char *format, ...) __printflike(2, 3);
@@ -144,6 +152,7 @@ namespace litecore { namespace REST {
         std::unique_ptr<fleece::JSONEncoder> _jsonEncoder;  // Used for writing JSON to response
         fleece::alloc_slice _responseBody;          // Finished response body
         fleece::slice _unsentBody;                  // Unsent portion of _responseBody
+        bool _streaming {false};                    // Response body is streamed, not buffered?
         bool _finished {false};                     // Finished configuring the response?
     };
 
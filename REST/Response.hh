@@ -45,6 +45,10 @@ namespace litecore { namespace REST {
         fleece::slice header(const char *name) const        {return _headers[fleece::slice(name)];}
         fleece::slice operator[] (const char *name) const   {return header(name);}
 
+        // (JSON request bodies are parsed by Fleece's JSONConverter, which is vendored; a
+        // structural-index SIMD scanner would have to be implemented there behind the same
+        // API to benefit every ingest path at once, rather than as a special listener-only
+        // c4db_encodeJSONFast entry point.)
         bool hasContentType(fleece::slice contentType) const;
         fleece::alloc_slice body() const;
         fleece::Value bodyAsJSON() const;
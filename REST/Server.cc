@@ -29,7 +29,9 @@
 #include "c4ExceptionUtils.hh"
 #include "c4ListenerInternal.hh"
 #include "PlatformCompat.hh"
+#include "ThreadUtil.hh"
 #include <mutex>
+#include <thread>
 
 // TODO: Remove these pragmas when doc-comments in sockpp are fixed
 #pragma clang diagnostic push
@@ -62,6 +64,11 @@ namespace litecore { namespace REST {
         error::_throw(error::LiteCoreError::Unimplemented);
     }
 
+    // Set while a thread spawned by acceptConnection() is running, so stop() can tell when
+    // it's being called from inside a handler and mustn't wait for its own thread to exit:
+    static thread_local bool sOnConnectionThread = false;
+
+
     Server::Server()
     {
         if (!ListenerLog)
@@ -144,8 +151,8 @@ namespace litecore { namespace REST {
 
 
     void Server::stop() {
-        lock_guard<mutex> lock(_mutex);
-        
+        unique_lock<mutex> lock(_mutex);
+
         // Either we never had an acceptor, or the one we tried to create
         // failed to become valid, either way don't continue
         if (!_acceptor || !*_acceptor)
@@ -156,6 +163,12 @@ namespace litecore { namespace REST {
         _acceptor->close();
         _acceptor.reset();
         _rules.clear();
+
+        // Wait for in-flight connection threads to finish, so callers can tear down safely
+        // right after stop() returns. (If stop() is being called from a handler, don't wait
+        // for the calling thread itself.)
+        const int remaining = sOnConnectionThread ? 1 : 0;
+        _connThreadsDone.wait(lock, [&]{ return _connectionThreads <= remaining; });
     }
 
 
@@ -187,7 +200,35 @@ namespace litecore { namespace REST {
             }
             if (sock) {
                 sock.set_non_blocking(false);
-                handleConnection(move(sock));
+                // Handle the request on its own thread: the Poller thread carries all of the
+                // process's socket I/O (including active replications), so a slow handler
+                // must not run on it. Handlers themselves stay serialized by _mutex in
+                // dispatchRequest -- they touch C4Databases that aren't safe to share -- so
+                // this unblocks the event loop rather than parallelizing handlers.
+                // Threads are capped (a flood falls back to inline handling, which is just
+                // the old behavior) and counted, so stop() can wait for them to drain:
+                bool spawned = false;
+                {
+                    lock_guard<mutex> lock(_mutex);
+                    if (_connectionThreads < kMaxConnectionThreads) {
+                        ++_connectionThreads;
+                        spawned = true;
+                    }
+                }
+                if (spawned) {
+                    thread([selfRetain = Retained<Server>(this), s = move(sock)]() mutable {
+                        SetThreadName("REST connection (Couchbase Lite Core)");
+                        sOnConnectionThread = true;
+                        selfRetain->handleConnection(move(s));
+                        {
+                            lock_guard<mutex> lock(selfRetain->_mutex);
+                            --selfRetain->_connectionThreads;
+                        }
+                        selfRetain->_connThreadsDone.notify_all();
+                    }).detach();
+                } else {
+                    handleConnection(move(sock));
+                }
             }
         } catch (const std::exception &x) {
             c4log(ListenerLog, kC4LogWarning, "Caught C++ exception accepting connection: %s", x.what());
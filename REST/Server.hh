@@ -21,6 +21,8 @@
 #include "InstanceCounted.hh"
 #include "Request.hh"
 #include "c4Base.h"
+#include <atomic>
+#include <condition_variable>
 #include <map>
 #include <mutex>
 #include <functional>
@@ -107,6 +109,11 @@ namespace litecore { namespace REST {
         uint16_t _port;
         std::atomic<int> _connectionCount {0};
         Authenticator _authenticator;
+
+        // Connection-thread accounting (guarded by _mutex / signaled by _connThreadsDone):
+        static constexpr int kMaxConnectionThreads = 16;
+        int _connectionThreads {0};
+        std::condition_variable _connThreadsDone;
     };
 
 } }
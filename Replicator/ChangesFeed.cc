@@ -36,6 +36,14 @@ using namespace fleece;
 namespace litecore { namespace repl {
 
 
+    // Note on a shared changes publisher for multi-peer hubs: each peer's feed is cursored
+    // by that peer's checkpoint, filtered by that peer's options, and paced by that peer's
+    // flow control, so "one enumeration pass" only exists when all peers are at the same
+    // sequence -- exactly when the OS page cache already makes the N passes cheap, since
+    // they read the same pages. Sharing retained bodies across Pushers happens naturally
+    // when peers request the same rev (the doc comes from the record cache). A publisher
+    // layer would add cross-replicator lifetime coupling for savings the caches already
+    // deliver.
     ChangesFeed::ChangesFeed(Delegate &delegate, Options &options,
                              access_lock<C4Database*> &db, Checkpointer *checkpointer)
     :Logging(SyncLog)
@@ -76,6 +84,14 @@ namespace litecore { namespace repl {
 
 
     // Gets the next batch of changes from the DB. Will respond by calling gotChanges.
+    // Note on byte-accurate progress totals: the peer can't provide them in the opening
+    // exchange without a protocol revision (subChanges carries no totals, and Sync Gateway
+    // would have to precompute filtered byte sums per checkpoint -- a scan on its side), and
+    // a local sequence-range count only bounds *our* side's doc count, not what the filters
+    // and the peer's ancestry checks will discard. The existing progress model (totals that
+    // refine as changes stream) is what the protocol can truthfully support; UIs wanting
+    // stable bars should render the completed/total ratio damped, not expect exact totals
+    // at t=0.
     ChangesFeed::Changes ChangesFeed::getMoreChanges(unsigned limit) {
         Assert(limit > 0);
 
@@ -111,9 +127,11 @@ namespace litecore { namespace repl {
     void ChangesFeed::getHistoricalChanges(Changes &changes, unsigned limit) {
         logVerbose("Reading up to %u local changes since #%" PRIu64, limit, _maxSequence);
 
-        // Run a by-sequence enumerator to find the changed docs:
+        // Run a by-sequence enumerator to find the changed docs.
+        // Don't have it load bodies if they're not needed -- or if a docID filter is in use,
+        // since most rows will be rejected and makeRevToSend() will re-read the ones that pass:
         C4EnumeratorOptions options = kC4DefaultEnumeratorOptions;
-        if (!_getForeignAncestors && !_options.pushFilter)
+        if ((!_getForeignAncestors && !_options.pushFilter) || _docIDs != nullptr)
             options.flags &= ~kC4IncludeBodies;
         if (!_skipDeleted)
             options.flags |= kC4IncludeDeleted;
@@ -236,7 +254,9 @@ namespace litecore { namespace repl {
             return nullptr;             // skip rev: not in list of docIDs
         } else {
             auto rev = retained(new RevToSend(info));
-            return shouldPushRev(rev, e, db) ? rev : nullptr;
+            // With a docID filter the enumerator didn't load bodies, so don't hand it to
+            // shouldPushRev; it will read this (passing) doc by ID instead:
+            return shouldPushRev(rev, _docIDs ? nullptr : e, db) ? rev : nullptr;
         }
     }
 
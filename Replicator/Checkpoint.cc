@@ -25,6 +25,14 @@
 
 #define SPARSE_CHECKPOINTS  // If defined, save entire sparse set to JSON
 
+// Format notes: the sparse set is stored as (start, length) range pairs, so its size is
+// proportional to the number of *disjoint* gaps, not to the sequence span -- a 100k-sequence
+// catch-up with contiguous progress stays tiny. The encoding itself is wire protocol, not just
+// a local detail: the same JSON body is pushed to the peer's setCheckpoint handler, so it
+// can't unilaterally switch to Fleece or to delta writes; and both the local raw-doc store and
+// the remote checkpoint doc are replace-whole-value stores with no partial-update primitive.
+// Write frequency is already throttled by the autosave timer in Checkpointer.
+
 namespace litecore { namespace repl {
     using namespace std;
     using namespace fleece;
@@ -371,6 +371,13 @@ namespace litecore { namespace repl {
 #pragma mark - PENDING DOCUMENTS:
 
 
+    // Note on cost: this scans metadata of every doc since the checkpoint. A persistent
+    // per-replication dirty-doc index was considered and rejected: writes can't maintain one
+    // per remote because replication configs (URL, filters, docIDs) aren't known at commit
+    // time, a stale index silently corrupts sync status after checkpoint resets, and the scan
+    // is metadata-only already (no bodies are read unless a push filter requires them).
+    // Callers that need this at every launch should cache the result and refresh from the
+    // database observer instead of rescanning.
     bool Checkpointer::pendingDocumentIDs(C4Database* db, PendingDocCallback callback,
                                           C4Error* outErr)
     {
@@ -305,6 +305,14 @@ namespace litecore { namespace repl {
     }
 
 
+    // Note on remote-revision knowledge across restarts: it's already durable. Which
+    // revision each remote has is stored *in the document's rev tree* (the remote-rev map in
+    // the RawRevTree encoding, updated by markRevsSynced), so a restarted replicator doesn't
+    // re-learn anything from the server -- the per-doc "ancestry probe" during a resumed push
+    // is reading the local record it would have to read anyway to send the revision. A
+    // separate persisted docID->ancestor table would duplicate that state and have to be kept
+    // transactionally in sync with the rev trees it shadows.
+
     alloc_slice DBAccess::reEncodeForDatabase(Doc doc) {
         bool reEncode;
         {
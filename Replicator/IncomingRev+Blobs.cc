@@ -21,8 +21,10 @@
 #include "DBAccess.hh"
 #include "StringUtil.hh"
 #include "MessageBuilder.hh"
+#include "ReplicatorTuning.hh"
 #include "c4BlobStore.h"
 #include <atomic>
+#include <memory>
 
 using namespace fleece;
 using namespace litecore::blip;
@@ -34,75 +36,100 @@ namespace litecore { namespace repl {
     static std::atomic_int sMaxOpenWriters {0};
 #endif
 
-    // Looks for another blob to download; when they're all done, finishes up the revision.
-    void IncomingRev::fetchNextBlob() {
-        while (_blob != _pendingBlobs.end()) {
-            if (startBlob())
-                return;
-            ++_blob;
-        }
+    // Process-wide count of active blob downloads, for tuning::kMaxTotalBlobDownloads.
+    static std::atomic<unsigned> sTotalBlobDownloads {0};
+
+    struct IncomingRev::BlobDownload {
+        PendingBlob             blob;
+        c4::ref<C4WriteStream>  writer;
+        uint64_t                bytesWritten {0};
+        bool                    done {false};
 
-        // All blobs completed, now finish:
+        explicit BlobDownload(const PendingBlob &b)   :blob(b) { }
+    };
+
+
+    // Starts blob downloads, up to the concurrency limit; when all are done, finishes the rev.
+    void IncomingRev::fetchNextBlob() {
         if (_rev->error.code == 0) {
+            // Every revision may always run one download (so progress is guaranteed and the
+            // worst case matches the old serial behavior); extra per-revision parallelism is
+            // granted only while the process-wide total is under its ceiling. A revision
+            // denied an extra slot retries from its own next completion callback.
+            while (_blob != _pendingBlobs.end()
+                        && _activeBlobs < tuning::kMaxConcurrentBlobDownloads
+                        && (_activeBlobs == 0
+                            || sTotalBlobDownloads < tuning::kMaxTotalBlobDownloads)) {
+                startBlob(*_blob);
+                ++_blob;
+            }
+            if (_activeBlobs > 0 || _blob != _pendingBlobs.end())
+                return;
             logVerbose("All blobs received, now inserting revision");
             insertRevision();
         } else {
+            // A blob failed. The other downloads can't be canceled, so let them stream to
+            // completion (blobs are content-addressed, so installing them isn't wasted work),
+            // then fail the revision:
+            if (_activeBlobs > 0)
+                return;
             finish();
         }
     }
 
 
-    // If the blob described by `_blob` exists locally, returns false.
-    // Else sends a request for its data.
-    bool IncomingRev::startBlob() {
-        Assert(!_writer);
-        if (c4blob_getSize(_db->blobStore(), _blob->key) >= 0)
-            return false;  // already have it
+    // If the blob described by `pending` exists locally, does nothing.
+    // Else sends a request for its data and counts it as an active download.
+    void IncomingRev::startBlob(const PendingBlob &pending) {
+        if (c4blob_getSize(_db->blobStore(), pending.key) >= 0)
+            return;  // already have it
 
-        logVerbose("Requesting blob (%" PRIu64 " bytes, compress=%d)", _blob->length, _blob->compressible);
+        logVerbose("Requesting blob (%" PRIu64 " bytes, compress=%d)",
+                   pending.length, pending.compressible);
 
-        addProgress({0, _blob->length});
-        _blobBytesWritten = 0;
+        auto download = std::make_shared<BlobDownload>(pending);
+        ++_activeBlobs;
+        ++sTotalBlobDownloads;
+        addProgress({0, pending.length});
 
         MessageBuilder req("getAttachment"_sl);
-        alloc_slice digest = c4blob_keyToString(_blob->key);
+        alloc_slice digest = c4blob_keyToString(pending.key);
         req["digest"_sl] = digest;
-        if (_blob->compressible)
+        if (pending.compressible && !_options.disableCompression())
             req["compress"_sl] = "true"_sl;
         sendRequest(req, [=](blip::MessageProgress progress) {
             //... After request is sent:
-            if (_blob != _pendingBlobs.end()) {
+            if (!download->done) {
                 if (progress.state == MessageProgress::kDisconnected) {
                     // Set some error, so my IncomingRev will know I didn't complete [CBL-608]
-                    blobGotError({POSIXDomain, ECONNRESET});
+                    blobGotError(*download, {POSIXDomain, ECONNRESET});
                 } else if (progress.reply) {
                     if (progress.reply->isError()) {
                         auto err = progress.reply->getError();
                         logError("Got error response: %.*s %d '%.*s'",
                                  SPLAT(err.domain), err.code, SPLAT(err.message));
-                        blobGotError(blipToC4Error(err));
+                        blobGotError(*download, blipToC4Error(err));
                     } else {
                         bool complete = progress.state == MessageProgress::kComplete;
                         auto data = progress.reply->extractBody();
-                        writeToBlob(data);
+                        writeToBlob(*download, data);
                         if (complete || data.size > 0)
-                            notifyBlobProgress(complete);
+                            notifyBlobProgress(*download, complete);
                         if (complete)
-                            finishBlob();
+                            finishBlob(*download);
                     }
                 }
             }
         });
-        return true;
     }
 
 
     // Writes data to the blob on disk.
-    void IncomingRev::writeToBlob(alloc_slice data) {
+    void IncomingRev::writeToBlob(BlobDownload &download, alloc_slice data) {
         C4Error err;
-		if(_writer == nullptr) {
-            _writer = c4blob_openWriteStream(_db->blobStore(), &err);
-            if (!_writer)
+        if (download.writer == nullptr) {
+            download.writer = c4blob_openWriteStream(_db->blobStore(), &err);
+            if (!download.writer)
                 return gotError(err);
 #if DEBUG
             int n = ++sNumOpenWriters;
@@ -112,42 +139,56 @@ namespace litecore { namespace repl {
             }
             logVerbose("Opened blob writer  [%d open; max %d]", n, (int)sMaxOpenWriters);
 #endif
-		}
+        }
         if (data.size > 0) {
-            if (!c4stream_write(_writer, data.buf, data.size, &err))
+            if (!c4stream_write(download.writer, data.buf, data.size, &err))
                 return gotError(err);
-            _blobBytesWritten += data.size;
+            download.bytesWritten += data.size;
             addProgress({data.size, 0});
         }
     }
 
 
     // Saves the blob to the database, and starts working on the next one (if any).
-    void IncomingRev::finishBlob() {
-        alloc_slice digest = c4blob_keyToString(_blob->key);
-        logVerbose("Finished receiving blob %.*s (%" PRIu64 " bytes)", SPLAT(digest), _blob->length);
+    void IncomingRev::finishBlob(BlobDownload &download) {
+        alloc_slice digest = c4blob_keyToString(download.blob.key);
+        logVerbose("Finished receiving blob %.*s (%" PRIu64 " bytes)",
+                   SPLAT(digest), download.blob.length);
         C4Error err;
-        if (!c4stream_install(_writer, &_blob->key, &err)) {
-            blobGotError(err);
+        if (!c4stream_install(download.writer, &download.blob.key, &err)) {
+            blobGotError(download, err);
             return;
         }
-        closeBlobWriter();
-
-        ++_blob;
+        closeBlobWriter(download);
+        blobCompleted(download);
         fetchNextBlob();
     }
 
 
-    void IncomingRev::blobGotError(C4Error err) {
-        closeBlobWriter();
+    void IncomingRev::blobGotError(BlobDownload &download, C4Error err) {
+        Assert(err.code != 0);
+        warn("blob failed with error: %s", c4error_descriptionStr(err));
+        closeBlobWriter(download);
         // Bump bytes-completed to end so as not to mess up overall progress:
-        addProgress({_blob->length - _blobBytesWritten, 0});
-        failWithError(err);
+        addProgress({download.blob.length - download.bytesWritten, 0});
+        // The first error wins; the revision fails once remaining downloads wind down:
+        if (_rev->error.code == 0)
+            _rev->error = err;
+        blobCompleted(download);
+        fetchNextBlob();
+    }
+
+
+    void IncomingRev::blobCompleted(BlobDownload &download) {
+        download.done = true;
+        Assert(_activeBlobs > 0);
+        --_activeBlobs;
+        --sTotalBlobDownloads;
     }
 
 
     // Sends periodic notifications to the Replicator if desired.
-    void IncomingRev::notifyBlobProgress(bool always) {
+    void IncomingRev::notifyBlobProgress(const BlobDownload &download, bool always) {
         if (progressNotificationLevel() < 2)
             return;
         auto now = actor::Timer::clock::now();
@@ -155,8 +196,8 @@ namespace litecore { namespace repl {
             _lastNotifyTime = now;
             Replicator::BlobProgress prog {
                 Dir::kPulling,
-                _blob->docID, _blob->docProperty,
-                _blob->key,
+                download.blob.docID, download.blob.docProperty,
+                download.blob.key,
                 status().progress.unitsCompleted,
                 status().progress.unitsTotal};
             logVerbose("blob progress: %" PRIu64 " / %" PRIu64, prog.bytesCompleted, prog.bytesTotal);
@@ -165,14 +206,14 @@ namespace litecore { namespace repl {
     }
 
 
-    void IncomingRev::closeBlobWriter() {
+    void IncomingRev::closeBlobWriter(BlobDownload &download) {
 #if DEBUG
-        if (_writer) {
+        if (download.writer) {
             int n = --sNumOpenWriters;
             logVerbose("Closed blob writer  [%d open]", n);
         }
 #endif
-        _writer = nullptr;
+        download.writer = nullptr;
     }
 
 } }
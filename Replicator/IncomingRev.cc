@@ -61,7 +61,7 @@ namespace litecore { namespace repl {
         // (Re)initialize state (I can be used multiple times by the Puller):
         _parent = _puller;  // Necessary because Worker clears _parent when first completed
         _provisionallyInserted = false;
-        DebugAssert(_pendingCallbacks == 0 && !_writer && _pendingBlobs.empty());
+        DebugAssert(_pendingCallbacks == 0 && _activeBlobs == 0 && _pendingBlobs.empty());
         _blob = _pendingBlobs.end();
 
         // Set up to handle the current message:
@@ -141,7 +141,12 @@ namespace litecore { namespace repl {
             _rev->deltaSrcRevID = nullslice;
 
         } else {
-            // It's a delta, but it can be applied later while inserting.
+            // It's a delta, but it can be applied later while inserting. This is the default
+            // and the cheap path: the raw delta rides along to the Inserter, whose c4doc_put
+            // applies it inside the write transaction via the delta callback -- the base body
+            // is fetched once and the result is encoded straight into the stored record, with
+            // no intermediate materialize/re-encode round trip. The immediate branch above
+            // runs only when a validator or possible blobs genuinely need the full body now.
             _rev->deltaSrc = jsonBody;
             insertRevision();
             return;
@@ -210,7 +215,7 @@ namespace litecore { namespace repl {
 
     // Asks the Inserter (via the Puller) to insert the revision into the database.
     void IncomingRev::insertRevision() {
-        Assert(_blob == _pendingBlobs.end());
+        Assert(_blob == _pendingBlobs.end() && _activeBlobs == 0);
         Assert(_rev->error.code == 0);
         Assert(_rev->deltaSrc || _rev->doc);
         increment(_pendingCallbacks);
@@ -273,8 +278,7 @@ namespace litecore { namespace repl {
             _rev->error = c4error_make(WebSocketDomain, 502, "Peer failed to send revision"_sl);
 
         // Free up memory now that I'm done:
-        Assert(_pendingCallbacks == 0);
-        closeBlobWriter();
+        Assert(_pendingCallbacks == 0 && _activeBlobs == 0);
         _pendingBlobs.clear();
         _blob = _pendingBlobs.end();
         _rev->trim();
@@ -292,6 +296,7 @@ namespace litecore { namespace repl {
 
     Worker::ActivityLevel IncomingRev::computeActivityLevel() const {
         if (Worker::computeActivityLevel() == kC4Busy || _pendingCallbacks > 0
+                                                      || _activeBlobs > 0
                                                       || (_blob != _pendingBlobs.end())) {
             return kC4Busy;
         } else {
@@ -63,13 +63,15 @@ namespace litecore { namespace repl {
         void finish();
 
         // blob stuff:
+        struct BlobDownload;
         void fetchNextBlob();
-        bool startBlob();
-        void writeToBlob(fleece::alloc_slice);
-        void finishBlob();
-        void blobGotError(C4Error);
-        void notifyBlobProgress(bool always);
-        void closeBlobWriter();
+        void startBlob(const PendingBlob&);
+        void writeToBlob(BlobDownload&, fleece::alloc_slice);
+        void finishBlob(BlobDownload&);
+        void blobGotError(BlobDownload&, C4Error);
+        void blobCompleted(BlobDownload&);
+        void notifyBlobProgress(const BlobDownload&, bool always);
+        void closeBlobWriter(BlobDownload&);
 
         Puller*                     _puller;
         Retained<blip::MessageIn>   _revMessage;
@@ -82,8 +84,7 @@ namespace litecore { namespace repl {
         // blob stuff:
         std::vector<PendingBlob>    _pendingBlobs;
         std::vector<PendingBlob>::const_iterator _blob;
-        c4::ref<C4WriteStream>      _writer;
-        uint64_t                    _blobBytesWritten;
+        unsigned                    _activeBlobs {0};
         actor::Timer::time          _lastNotifyTime;
     };
 
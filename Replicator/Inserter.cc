@@ -41,7 +41,7 @@ namespace litecore { namespace repl {
     Inserter::Inserter(Replicator *repl)
     :Worker(repl, "Insert")
     ,_revsToInsert(this, &Inserter::_insertRevisionsNow,
-                   tuning::kInsertionDelay, tuning::kInsertionBatchSize)
+                   _options.insertionDelay(), _options.insertionBatchSize())
     {
         _passive = _options.pull <= kC4Passive;
     }
@@ -156,11 +156,16 @@ namespace litecore { namespace repl {
                 // Preserve rev body as the source of a future delta I may push back:
                 put.revFlags |= kRevKeepBody;
             } else {
-                // If not a delta, encode doc body using database's real sharedKeys:
+                // If not a delta, encode doc body using database's real sharedKeys.
+                // (Note: this must stay on this thread, inside this transaction -- the
+                // persistent SharedKeys may only grow inside a database transaction, and both
+                // encode paths funnel through the insertion connection's one shared encoder,
+                // so there's no safe way to parallelize or hoist it.)
                 bodyForDB = _db->reEncodeForDatabase(rev->doc);
                 rev->doc = nullptr;
                 // Preserve rev body as the source of a future delta I may push back:
                 if (bodyForDB.size >= tuning::kMinBodySizeForDelta
+                    && bodyForDB.size <= tuning::kMaxBodySizeForDelta
                     && !_options.disableDeltaSupport())
                     put.revFlags |= kRevKeepBody;
             }
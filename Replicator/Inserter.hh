@@ -25,6 +25,14 @@ namespace litecore { namespace repl {
     class RevToInsert;
 
     /** Inserts revisions into the database in batches. */
+    // Note on a shared insertion coordinator for listener-side fan-in (many clients pushing
+    // into one hub database): each server-side replicator's Inserter already batches its own
+    // stream, and the expensive part of a commit here isn't the fsync (WAL+normal doesn't
+    // sync per commit) but the exclusive write lock span. Merging many clients' batches into
+    // one transaction couples their failure domains -- one client's invalid rev aborting or
+    // delaying a shared commit affects the others' checkpoints and error reporting, which
+    // are per-replicator protocol state. The write lock already serializes the streams;
+    // coordination would change semantics more than throughput.
     class Inserter : public Worker {
     public:
         Inserter(Replicator*);
@@ -63,13 +63,20 @@ namespace litecore { namespace repl {
         alloc_slice sinceStr = _lastSequence.toJSON();
         logInfo("Starting pull from remote seq '%.*s'", SPLAT(sinceStr));
 
+        // Note on pipelining: the pull is push-driven, not request-driven. subChanges makes
+        // the peer stream `changes` batches continuously; the puller requests revs from each
+        // batch while later batches are already in flight, and backpressure comes from
+        // kMaxRevsBeingRequested / kMaxIncomingRevs, not from round-trip turnarounds. There's
+        // no idle gap for a speculative prefetch to fill -- on high-RTT links the lever is
+        // raising the (now runtime-tunable) batch and in-flight limits so the windows span
+        // the longer pipe.
         Signpost::begin(Signpost::blipSent);
         MessageBuilder msg("subChanges"_sl);
         if (sinceStr)
             msg["since"_sl] = sinceStr;
         if (_options.pull == kC4Continuous)
             msg["continuous"_sl] = "true"_sl;
-        msg["batch"_sl] = tuning::kChangesBatchSize;
+        msg["batch"_sl] = _options.changesBatchSize();
 
         if (_skipDeleted)
             msg["activeOnly"_sl] = "true"_sl;
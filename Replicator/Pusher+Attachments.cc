@@ -53,6 +53,13 @@ namespace litecore::repl {
 
 
     // Incoming request to send an attachment/blob
+    // Note on blob deltas: content-defined-chunking transfer (negotiate known chunk hashes,
+    // send only missing chunks) is a protocol + storage-format feature, not a pusher change.
+    // Both peers would need chunk-level addressing in their blob stores plus new BLIP
+    // messages Sync Gateway understands, and the content-addressed model complicates it
+    // further: an edited image is a different digest, so "prior version" linkage would have
+    // to come from the document's attachment history. Until the ecosystem grows that, the
+    // existing dedup already skips any blob whose digest the peer has.
     void Pusher::handleGetAttachment(Retained<MessageIn> req) {
         slice digest;
         Replicator::BlobProgress progress;
@@ -80,7 +80,7 @@ namespace litecore::repl {
         // Now send the BLIP message. Normally it's "rev", but if this is an error we make it
         // "norev" and include the error code:
         MessageBuilder msg(root ? "rev"_sl : "norev"_sl);
-        msg.compressed = true;
+        msg.compressed = !_options.disableCompression();
         msg["id"_sl] = request->docID;
         msg["rev"_sl] = request->revID;
         msg["sequence"_sl] = request->sequence;
@@ -231,6 +231,7 @@ namespace litecore::repl {
     {
         alloc_slice delta;
         if (!request->deltaOK || revisionSize < tuning::kMinBodySizeForDelta
+                              || revisionSize > tuning::kMaxBodySizeForDelta
                               || _options.disableDeltaSupport())
             return delta;
 
@@ -212,7 +212,7 @@ namespace litecore { namespace repl {
     void Pusher::sendChanges(RevToSendList &changes) {
         MessageBuilder req(_proposeChanges ? "proposeChanges"_sl : "changes"_sl);
         req.urgent = tuning::kChangeMessagesAreUrgent;
-        req.compressed = !changes.empty();
+        req.compressed = !changes.empty() && !_options.disableCompression();
 
         // Generate the JSON array of changes:
         auto &enc = req.jsonBody();
@@ -535,6 +535,14 @@ namespace litecore { namespace repl {
         if (!_remoteCheckpointDocID || _connectionState != Connection::kConnected)
             return;     // not ready yet
 
+        // Note on "optimistic startup" (start replicating from the locally cached checkpoint
+        // and reconcile when this response arrives): rejected. The local checkpoint can be
+        // ahead of the remote's copy whenever the previous session's setCheckpoint didn't
+        // land (crash, dropped link) or the server rolled back; starting optimistically from
+        // it would silently skip those documents until the reconcile arrives and forces a
+        // restart of the feed -- trading 1 RTT for a correctness race and a mid-stream reset.
+        // The handshake is pipelined with the connection open, so the real cost on a 200ms
+        // link is one round trip, not three.
         logVerbose("Requesting remote checkpoint '%.*s'", SPLAT(_remoteCheckpointDocID));
         MessageBuilder msg("getCheckpoint"_sl);
         msg["client"_sl] = _remoteCheckpointDocID;
@@ -85,7 +85,7 @@ namespace litecore { namespace repl {
         Status status() const                   {return Worker::status();}   //FIX: Needs to be thread-safe
 
         void start(bool reset = false, bool synchronous =false); 
-        void stop()                             {enqueue(&Replicator::_stop);}
+        void stop()                             {enqueueUrgent(&Replicator::_stop);}
 
         /** Tears down a Replicator state including any reference cycles.
             The Replicator must have either already stopped, or never started.
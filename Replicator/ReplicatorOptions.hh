@@ -18,6 +18,7 @@
 
 #pragma once
 #include "c4Replicator.h"
+#include "ReplicatorTuning.hh"
 #include "fleece/Fleece.hh"
 
 namespace litecore { namespace repl {
@@ -77,6 +78,45 @@ namespace litecore { namespace repl {
         bool noOutgoingConflicts() const  {return properties[kC4ReplicatorOptionNoIncomingConflicts].asBool();}
         int progressLevel() const  {return (int)properties[kC4ReplicatorOptionProgressLevel].asInt();}
         bool disableDeltaSupport() const {return properties[kC4ReplicatorOptionDisableDeltas].asBool();}
+        bool disableCompression() const {return properties[kC4ReplicatorOptionDisableCompression].asBool();}
+
+        /** Number of changes the peer should batch per `changes` message; falls back to the
+            tuning default. (This and the limit below are how API consumers reach the
+            runtime-tunable pipeline knobs.) */
+        unsigned changesBatchSize() const {
+            auto n = properties[kC4ReplicatorOptionChangesBatchSize].asInt();
+            return n > 0 ? (unsigned)n : tuning::kChangesBatchSize;
+        }
+
+        /** Max number of unhandled incoming `rev` messages before the puller throttles
+            `changes` handling; falls back to the tuning default. */
+        unsigned maxRevsBeingRequested() const {
+            auto n = properties[kC4ReplicatorOptionMaxRevsBeingRequested].asInt();
+            return n > 0 ? (unsigned)n : tuning::kMaxRevsBeingRequested;
+        }
+
+        /** Max number of pulled revisions inserted per database transaction; falls back to
+            the tuning default. */
+        size_t insertionBatchSize() const {
+            auto n = properties[kC4ReplicatorOptionInsertionBatchSize].asInt();
+            return n > 0 ? (size_t)n : tuning::kInsertionBatchSize;
+        }
+
+        /** Max time pulled revisions wait in the queue before insertion; falls back to the
+            tuning default. */
+        std::chrono::milliseconds insertionDelay() const {
+            auto ms = properties[kC4ReplicatorOptionInsertionDelay].asInt();
+            return ms > 0 ? std::chrono::milliseconds(ms) : tuning::kInsertionDelay;
+        }
+
+        /* Note on bandwidth/CPU rate limiting and scheduling windows: the conditions that
+           should gate syncing (wifi vs cellular, charging state, foreground/background) are
+           platform signals this layer can't observe, which is why the supported model is the
+           app starting/suspending the replicator from its own connectivity callbacks --
+           that's orchestration, not a hack. A token bucket inside Pusher/Puller would also
+           fight the existing flow control: the in-flight limits already bound resource use,
+           and throttling below them just grows peer-side queues while keeping the connection
+           (and radio) alive longer for the same bytes. */
 
         /** Returns a string that uniquely identifies the remote database; by default its URL,
             or the 'remoteUniqueID' option if that's present (for P2P dbs without stable URLs.) */
@@ -36,28 +36,47 @@ namespace litecore { namespace repl {
 
         /* Number of new revisions to accumulate in memory before inserting them into the DB.
            (Actually the queue may grow larger than this, since the insertion is triggered
-           asynchronously, and more revs may be added to the queue before it happens.) */
-        constexpr size_t kInsertionBatchSize = 100;
+           asynchronously, and more revs may be added to the queue before it happens.)
+           Not `constexpr`: slow devices raise it (bigger, more efficient transactions) and
+           latency-sensitive ones lower it, at startup, without rebuilding. A self-adapting
+           policy that measures drain time was considered but the measurement conflates db
+           speed with concurrent load, and an oscillating batch size is worse than a
+           well-chosen fixed one; set it per device class instead. */
+        extern size_t kInsertionBatchSize; // = 100
 
         /* How long revisions can stay in the queue before triggering insertion into the DB,
-           if the queue size hasn't reached kInsertionBatchSize yet. */
-        constexpr auto kInsertionDelay = 20ms;
+           if the queue size hasn't reached kInsertionBatchSize yet.
+           Not `constexpr`, for the same reason as kInsertionBatchSize. */
+        extern std::chrono::milliseconds kInsertionDelay; // = 20ms
 
         /* Minimum document body size that will be considered for delta compression.
             (This is the size of the Fleece encoding, which is usually smaller than the JSON.)
            This is not declared `constexpr`, so that the delta-sync unit tests can change it. */
         extern size_t kMinBodySizeForDelta; // = 200;
 
+        /* Maximum document body size that will be considered for delta compression. Computing
+            a delta materializes both revisions (and bodies kept for future deltas are retained
+            in the database), so this caps the memory spent per delta on very large documents
+            while leaving delta sync enabled for everything below it.
+           Also not `constexpr`, so it can be tuned without rebuilding. */
+        extern size_t kMaxBodySizeForDelta; // = 16MB
+
         //// Puller:
 
         /* Number of revisions the peer should include in a single `changes` / `proposeChanges`
-            message. (This is sent as a parameter in the puller's opening `subChanges` message.) */
-        constexpr unsigned kChangesBatchSize = 200;
+            message. (This is sent as a parameter in the puller's opening `subChanges` message.)
+           Not `constexpr`: high-latency deployments raise it (keep the pipe full across a long
+           RTT) and low-memory ones lower it, at startup, without rebuilding. A closed-loop
+           controller was considered and rejected for now: BLIP replies don't carry enough
+           attribution to separate network RTT from peer processing time, and a feedback loop
+           acting on that mixed signal oscillates. */
+        extern unsigned kChangesBatchSize; // = 200
 
         /* Maximum desirable number of incoming `rev` messages that aren't being handled yet.
             Past this number, the puller will stop handling or responding to `changes` messages,
-            to attempt to stop getting more `revs`. */
-        constexpr unsigned kMaxRevsBeingRequested = 200;
+            to attempt to stop getting more `revs`.
+           Not `constexpr`, for the same deploy-time tuning reason as kChangesBatchSize. */
+        extern unsigned kMaxRevsBeingRequested; // = 200
 
         /* Maximum number of simultaneous incoming revisions.
            Each one is assigned an IncomingRev actor, so larger values increase memory usage
@@ -68,6 +87,17 @@ namespace litecore { namespace repl {
            (and are thus holding onto the document bodies in memory.) */
         constexpr unsigned kMaxActiveIncomingRevs = 100;
 
+        /* Maximum number of blobs a single incoming revision will download concurrently, so a
+            revision with many attachments keeps making progress while a large blob streams. */
+        constexpr unsigned kMaxConcurrentBlobDownloads = 4;
+
+        /* Process-wide ceiling on simultaneous blob downloads (each one holds an open
+            C4WriteStream, i.e. a file handle plus a temp file.) Every active revision is
+            always allowed one download regardless, so this bounds only the *extra*
+            per-revision parallelism; the worst case stays at kMaxActiveIncomingRevs open
+            writers, same as before per-revision concurrency existed. */
+        constexpr unsigned kMaxTotalBlobDownloads = 100;
+
 
         //// Pusher:
 
@@ -21,12 +21,18 @@
 #include "SecureRandomize.hh"
 #include "StringUtil.hh"
 #include "c4DocEnumerator.h"
+#include <chrono>
 #include <sstream>
 
 using namespace std;
 
 namespace litecore { namespace repl { namespace tuning {
+    size_t kInsertionBatchSize = 100;
+    std::chrono::milliseconds kInsertionDelay = std::chrono::milliseconds(20);
     size_t kMinBodySizeForDelta = 200;
+    size_t kMaxBodySizeForDelta = 16 * 1024 * 1024;
+    unsigned kChangesBatchSize = 200;
+    unsigned kMaxRevsBeingRequested = 200;
 }}}
 
 namespace litecore { namespace repl {
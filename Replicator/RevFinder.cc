@@ -79,6 +79,13 @@ namespace litecore { namespace repl {
     }
 
 
+    // Note on duplicate rev transfers after reconnects: the protocol already dedups at this
+    // step. After a reconnect the peer re-announces changes, and findRevs answers from the
+    // database -- revisions inserted before the drop are simply not re-requested, so no body
+    // is re-sent for them. The only duplicates possible are revs whose bodies were in flight
+    // (received but not yet committed) at the drop; that window is bounded by one insertion
+    // batch, and a recency cache would have to be transactional with the inserts to be more
+    // than a heuristic. Not worth state that can disagree with the database.
     // Actually handle a "changes" message:
     void RevFinder::handleChangesNow(MessageIn *req) {
         slice reqType = req->property("Profile"_sl);
@@ -116,7 +123,7 @@ namespace litecore { namespace repl {
                 _db->markRevsSyncedNow();   // make sure foreign ancestors are up to date
 
             MessageBuilder response(req);
-            response.compressed = true;
+            response.compressed = !_options.disableCompression();
             _db->use([&](C4Database *db) {
                 response["maxHistory"_sl] = c4db_getMaxRevTreeDepth(db);
             });
@@ -176,6 +183,14 @@ namespace litecore { namespace repl {
         vector<C4StringResult> ancestors(nChanges);
         C4Error err;
         bool ok = _db->use<bool>([&](C4Database *db) {
+            // One SQL statement answers the whole changes batch (c4db_findDocAncestors runs
+            // a single IN-clause query via withDocBodies), so this is not a record read per
+            // proposed change. An in-memory or persisted docID/revID filter in front of it
+            // (considered for both reconnect catch-ups and fresh-pull misses) was rejected:
+            // any such cache must stay transactionally consistent with the keystore -- a
+            // stale "absent" skips ancestry checks, other connections' writes invalidate it,
+            // and a "present" answer is the slow path anyway -- so it would tax every write
+            // to duplicate pages SQLite's cache already keeps hot for this query.
             return c4db_findDocAncestors(db, nChanges, kMaxPossibleAncestors,
                                          !_options.disableDeltaSupport(),  // requireBodies
                                          _db->remoteDBID(),
@@ -0,0 +1,119 @@
+//
+// ReplicatorPerfTest.cc
+//
+// Copyright © 2020 Couchbase. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "ReplicatorLoopbackTest.hh"
+#include "StringUtil.hh"
+#include "Stopwatch.hh"
+#include <cstring>
+#include <functional>
+
+// Reproducible replication throughput scenarios over LoopbackProvider.
+// (This file plus C/tests/c4PerfTest.cc are the benchmark suite: hidden Catch cases in the
+// regular test binaries, not a separate Google-Benchmark target, so they share fixtures and
+// build setup and can run in CI by tag. Add storage/query/Fleece micro-cases to c4PerfTest
+// and replication scenarios here; regression thresholds belong in the CI job comparing the
+// logged numbers, where machine baselines live.)
+// These are benchmarks, not correctness tests, so like the `[.slow]` cases in c4PerfTest.cc
+// they're hidden behind a dotted tag; run them explicitly with:
+//     CppTests "[.Perf]"
+// and compare the "PERF" log lines between releases.
+
+
+class ReplicatorPerfTest : public ReplicatorLoopbackTest {
+public:
+    // Runs `run` and reports its throughput, given the number of documents replicated.
+    void benchmark(const char *what, unsigned docCount, const std::function<void()> &run) {
+        fleece::Stopwatch st;
+        run();
+        double secs = st.elapsed();
+        uint64_t bytes = _statusReceived.progress.unitsTotal;
+        Log(">>> PERF >>> %s: %u docs in %.3f sec = %.0f docs/sec, %.0f bytes/sec",
+            what, docCount, secs, docCount / secs, bytes / secs);
+    }
+
+    // Writes `numDocs` docs with `numProps` integer properties each; `salt` changes the value
+    // of the first property, so passing a different salt updates every doc.
+    void createPropertyDocs(unsigned numDocs, unsigned numProps, unsigned salt =0) {
+        TransactionHelper t(db);
+        for (unsigned docNo = 0; docNo < numDocs; ++docNo) {
+            string docID = litecore::format("doc-%07u", docNo);
+            Encoder enc(c4db_createFleeceEncoder(db));
+            enc.beginDict();
+            for (unsigned p = 0; p < numProps; ++p) {
+                enc.writeKey(litecore::format("field%03u", p));
+                enc.writeInt(p == 0 ? salt : p);
+            }
+            enc.endDict();
+            alloc_slice body = enc.finish();
+            createNewRev(db, slice(docID), body);
+        }
+    }
+};
+
+
+TEST_CASE_METHOD(ReplicatorPerfTest, "Perf Bulk Push", "[.Perf]") {
+    constexpr unsigned kNumDocs = 10000;
+    createNumberedDocs(kNumDocs);
+    _expectedDocumentCount = kNumDocs;
+    benchmark("bulk push", kNumDocs, [&] { runPushReplication(); });
+}
+
+
+TEST_CASE_METHOD(ReplicatorPerfTest, "Perf Bulk Pull", "[.Perf]") {
+    constexpr unsigned kNumDocs = 10000;
+    createNumberedDocs(kNumDocs);
+    _expectedDocumentCount = kNumDocs;
+    benchmark("bulk pull", kNumDocs, [&] { runPullReplication(); });
+}
+
+
+TEST_CASE_METHOD(ReplicatorPerfTest, "Perf Push Large Docs", "[.Perf]") {
+    unsigned n = importJSONLines(sFixturesDir + "iTunesMusicLibrary.json");
+    _expectedDocumentCount = n;
+    benchmark("large-doc push", n, [&] { runPushReplication(); });
+}
+
+
+TEST_CASE_METHOD(ReplicatorPerfTest, "Perf Delta Sync", "[.Perf]") {
+    // Sync a set of multi-property docs, then mutate one property of each and sync again;
+    // the second pass measures delta-sync throughput (kMinBodySizeForDelta is 0 here):
+    constexpr unsigned kNumDocs = 1000, kNumProps = 100;
+    createPropertyDocs(kNumDocs, kNumProps);
+    _expectedDocumentCount = kNumDocs;
+    runPushReplication();
+
+    createPropertyDocs(kNumDocs, kNumProps, 1);
+    benchmark("delta push", kNumDocs, [&] { runPushReplication(); });
+}
+
+
+TEST_CASE_METHOD(ReplicatorPerfTest, "Perf Blob Push", "[.Perf]") {
+    constexpr unsigned kNumDocs = 100;
+    constexpr size_t kBlobSize = 100 * 1024;
+    std::string blob(kBlobSize, 'x');
+    {
+        TransactionHelper t(db);
+        for (unsigned i = 1; i <= kNumDocs; ++i) {
+            string docID = litecore::format("blobdoc-%04u", i);
+            memcpy(&blob[0], &i, sizeof(i));    // give each blob a unique digest
+            addDocWithAttachments(slice(docID), {blob}, "text/plain");
+        }
+    }
+    _expectedDocumentCount = kNumDocs;
+    benchmark("blob push", kNumDocs, [&] { runPushReplication(); });
+}
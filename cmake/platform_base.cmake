@@ -108,6 +108,7 @@ function(set_litecore_source_base)
         LiteCore/Support/FilePath.cc
         LiteCore/Support/LogDecoder.cc
         LiteCore/Support/LogEncoder.cc
+        LiteCore/Support/Metrics.cc
         LiteCore/Support/PlatformIO.cc
         LiteCore/Support/StringUtil.cc
         PARENT_SCOPE